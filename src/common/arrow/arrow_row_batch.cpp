@@ -1,5 +1,6 @@
 #include "common/arrow/arrow_row_batch.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/exception/runtime.h"
@@ -7,6 +8,7 @@
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -951,8 +953,113 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+static bool canCopyColumnar(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ArrowRowBatch::canAppendColumnar(main::QueryResult& queryResult,
+    const std::vector<LogicalType>& types) {
+    auto table = queryResult.getTable();
+    if (table == nullptr || queryResult.getIterator() == nullptr || table->hasUnflatCol()) {
+        return false;
+    }
+    KU_ASSERT(table->getTableSchema()->getNumColumns() == types.size());
+    return std::all_of(types.begin(), types.end(), canCopyColumnar);
+}
+
+std::int64_t ArrowRowBatch::appendColumnar(main::QueryResult& queryResult,
+    std::int64_t chunkSize) {
+    if (!queryResult.hasNext()) {
+        return 0;
+    }
+    auto& table = *queryResult.getTable();
+    auto iterator = queryResult.getIterator();
+    const auto startTupleIdx = iterator->getNextTupleIdx();
+    const auto numTuplesToCopy =
+        std::min<std::int64_t>(chunkSize, table.getNumTuples() - startTupleIdx);
+    for (auto i = 0u; i < types.size(); i++) {
+        copyColumn(vectors[i].get(), types[i], table, i, startTupleIdx, numTuplesToCopy);
+    }
+    iterator->skipTuples(numTuplesToCopy);
+    return numTuplesToCopy;
+}
+
+void ArrowRowBatch::copyColumn(ArrowVector* vector, const LogicalType& type,
+    const processor::FactorizedTable& table, uint32_t colIdx, uint64_t startTupleIdx,
+    std::int64_t numTuplesToCopy) {
+    const auto tableSchema = table.getTableSchema();
+    const auto colOffset = tableSchema->getColOffset(colIdx);
+    const auto nullMapOffset = tableSchema->getNullMapOffset();
+    const auto hasNoNulls = table.hasNoNullGuarantee(colIdx);
+    const auto isString = type.getPhysicalType() == PhysicalTypeID::STRING;
+    const auto valSize = LogicalTypeUtils::getRowLayoutSize(type);
+    for (std::int64_t i = 0; i < numTuplesToCopy; i++) {
+        const auto tuple = table.getTuple(startTupleIdx + i);
+        const auto pos = vector->numValues + i;
+        if (!hasNoNulls && table.isNonOverflowColNull(tuple + nullMapOffset, colIdx)) {
+            if (isString) {
+                templateCopyNullValue<LogicalTypeID::STRING>(vector, pos);
+            } else {
+                setBitToZero(vector->validity.data(), pos);
+                vector->numNulls++;
+            }
+            continue;
+        }
+        const auto cell = tuple + colOffset;
+        if (isString) {
+            const auto& str = *reinterpret_cast<const ku_string_t*>(cell);
+            auto offsets = reinterpret_cast<std::uint32_t*>(vector->data.data());
+            if (pos == 0) {
+                offsets[pos] = 0;
+            }
+            offsets[pos + 1] = offsets[pos] + str.len;
+            vector->overflow.resize(offsets[pos + 1] + 1);
+            std::memcpy(vector->overflow.data() + offsets[pos], str.getData(), str.len);
+        } else if (type.getLogicalTypeID() == LogicalTypeID::BOOL) {
+            if (*reinterpret_cast<const bool*>(cell)) {
+                setBitToOne(vector->data.data(), pos);
+            } else {
+                setBitToZero(vector->data.data(), pos);
+            }
+        } else {
+            // The arrow layout of the remaining types matches their row layout.
+            std::memcpy(vector->data.data() + pos * valSize, cell, valSize);
+        }
+    }
+    vector->numValues += numTuplesToCopy;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
     std::int64_t numTuplesInBatch = 0;
+    if (canAppendColumnar(queryResult, types)) {
+        numTuplesInBatch = appendColumnar(queryResult, chunkSize);
+        numTuples += numTuplesInBatch;
+        return toArray();
+    }
     auto numColumns = queryResult.getColumnNames().size();
     while (numTuplesInBatch < chunkSize) {
         if (!queryResult.hasNext()) {
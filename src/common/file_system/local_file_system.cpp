@@ -15,12 +15,16 @@
 #include <windows.h>
 #else
 #include "sys/stat.h"
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
 #include <fcntl.h>
 
+#include <algorithm>
+#include <climits>
 #include <cstring>
+#include <vector>
 
 namespace kuzu {
 namespace common {
@@ -368,6 +372,108 @@ void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint6
     }
 }
 
+#if defined(__linux__)
+// Requests that cover adjacent file ranges are merged into a single preadv/pwritev call. Each call
+// is capped at IOV_MAX buffers and 1GB, same as writeFile.
+static constexpr uint64_t MAX_BYTES_PER_VECTORED_IO = 1ull << 30;
+
+static std::vector<const FileIORequest*> sortRequestsByOffset(
+    std::span<const FileIORequest> requests) {
+    std::vector<const FileIORequest*> sorted;
+    sorted.reserve(requests.size());
+    for (auto& request : requests) {
+        if (request.numBytes > 0) {
+            sorted.push_back(&request);
+        }
+    }
+    // Stable so that requests on the same range are still applied in the given order.
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const auto* a, const auto* b) { return a->offset < b->offset; });
+    return sorted;
+}
+
+// Returns the end (exclusive) of the run of requests starting at startIdx that can be issued as
+// one vectored call.
+static uint64_t getEndOfAdjacentRun(const std::vector<const FileIORequest*>& sorted,
+    uint64_t startIdx) {
+    auto endIdx = startIdx + 1;
+    auto numBytes = sorted[startIdx]->numBytes;
+    while (endIdx < sorted.size() && endIdx - startIdx < IOV_MAX &&
+           sorted[endIdx]->offset == sorted[endIdx - 1]->offset + sorted[endIdx - 1]->numBytes &&
+           numBytes + sorted[endIdx]->numBytes <= MAX_BYTES_PER_VECTORED_IO) {
+        numBytes += sorted[endIdx]->numBytes;
+        endIdx++;
+    }
+    return endIdx;
+}
+
+template<typename VECTORED_IO, typename SINGLE_IO>
+static void performVectoredIO(std::span<const FileIORequest> requests, VECTORED_IO vectoredIO,
+    SINGLE_IO singleIO) {
+    const auto sorted = sortRequestsByOffset(requests);
+    std::vector<iovec> iovecs;
+    uint64_t startIdx = 0;
+    while (startIdx < sorted.size()) {
+        const auto endIdx = getEndOfAdjacentRun(sorted, startIdx);
+        if (endIdx - startIdx == 1) {
+            singleIO(*sorted[startIdx]);
+            startIdx = endIdx;
+            continue;
+        }
+        iovecs.clear();
+        uint64_t numBytes = 0;
+        for (auto i = startIdx; i < endIdx; i++) {
+            iovecs.push_back(iovec{sorted[i]->buffer, sorted[i]->numBytes});
+            numBytes += sorted[i]->numBytes;
+        }
+        const auto numBytesDone =
+            vectoredIO(iovecs.data(), static_cast<int>(iovecs.size()), sorted[startIdx]->offset);
+        if (numBytesDone != static_cast<int64_t>(numBytes)) {
+            // Partial reads (e.g. at the end of the file) and errors are handled, and reported,
+            // by the single request path.
+            for (auto i = startIdx; i < endIdx; i++) {
+                singleIO(*sorted[i]);
+            }
+        }
+        startIdx = endIdx;
+    }
+}
+#endif
+
+void LocalFileSystem::readFromFileBatch(FileInfo& fileInfo,
+    std::span<const FileIORequest> requests) const {
+#if defined(__linux__)
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    performVectoredIO(
+        requests,
+        [&](const iovec* iov, int iovcnt, uint64_t offset) {
+            return preadv(localFileInfo->fd, iov, iovcnt, offset);
+        },
+        [&](const FileIORequest& request) {
+            readFromFile(fileInfo, request.buffer, request.numBytes, request.offset);
+        });
+#else
+    FileSystem::readFromFileBatch(fileInfo, requests);
+#endif
+}
+
+void LocalFileSystem::writeFileBatch(FileInfo& fileInfo,
+    std::span<const FileIORequest> requests) const {
+#if defined(__linux__)
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    performVectoredIO(
+        requests,
+        [&](const iovec* iov, int iovcnt, uint64_t offset) {
+            return pwritev(localFileInfo->fd, iov, iovcnt, offset);
+        },
+        [&](const FileIORequest& request) {
+            writeFile(fileInfo, request.buffer, request.numBytes, request.offset);
+        });
+#else
+    FileSystem::writeFileBatch(fileInfo, requests);
+#endif
+}
+
 void LocalFileSystem::syncFile(const FileInfo& fileInfo) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
 #if defined(_WIN32)
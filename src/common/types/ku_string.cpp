@@ -54,6 +54,11 @@ bool ku_string_t::operator==(const ku_string_t& rhs) const {
         sizeof(uint32_t) +
         std::min((uint64_t)len, static_cast<uint64_t>(ku_string_t::PREFIX_LENGTH));
     if (!memcmp(this, &rhs, numBytesOfLenAndPrefix)) {
+        // Strings scanned from the same dictionary entry share their overflow buffer, in which
+        // case there is nothing left to compare.
+        if (getData() == rhs.getData()) {
+            return true;
+        }
         // If length and prefix of a and b are equal, we compare the overflow buffer.
         return !memcmp(getData(), rhs.getData(), len);
     }
@@ -66,7 +71,7 @@ bool ku_string_t::operator>(const ku_string_t& rhs) const {
     auto sharedLen = std::min(len, rhs.len);
     auto memcmpResult = memcmp(prefix, rhs.prefix,
         sharedLen <= ku_string_t::PREFIX_LENGTH ? sharedLen : ku_string_t::PREFIX_LENGTH);
-    if (memcmpResult == 0 && len > ku_string_t::PREFIX_LENGTH) {
+    if (memcmpResult == 0 && len > ku_string_t::PREFIX_LENGTH && getData() != rhs.getData()) {
         memcmpResult = memcmp(getData(), rhs.getData(), sharedLen);
     }
     if (memcmpResult == 0) {
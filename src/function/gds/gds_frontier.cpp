@@ -1,30 +1,46 @@
 #include "function/gds/gds_frontier.h"
 
+#include <algorithm>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace function {
 
 FrontierMorselDispatcher::FrontierMorselDispatcher(uint64_t _maxThreadsForExec)
-    : morselSize(UINT64_MAX) {
+    : sparseOffsets{nullptr}, morselSize(UINT64_MAX) {
     maxThreadsForExec.store(_maxThreadsForExec);
     tableID.store(INVALID_TABLE_ID);
     numOffsets.store(INVALID_OFFSET);
     nextOffset.store(INVALID_OFFSET);
 }
 
-void FrontierMorselDispatcher::init(common::table_id_t _tableID, common::offset_t _numOffsets) {
-    tableID.store(_tableID);
-    numOffsets.store(_numOffsets);
-    nextOffset.store(0u);
+uint64_t FrontierMorselDispatcher::computeMorselSize(uint64_t minMorselSize) const {
     // Frontier size calculation: The ideal scenario is to have k^2 many morsels where k
     // the number of maximum threads that could be working on this frontier. However if
-    // that is too small then we default to MIN_FRONTIER_MORSEL_SIZE.
+    // that is too small then we default to minMorselSize.
     auto idealMorselSize = numOffsets.load(std::memory_order_relaxed) /
                            (std::max(MIN_NUMBER_OF_FRONTIER_MORSELS,
                                maxThreadsForExec.load(std::memory_order_relaxed) *
                                    maxThreadsForExec.load(std::memory_order_relaxed)));
-    morselSize = std::max(MIN_FRONTIER_MORSEL_SIZE, idealMorselSize);
+    return std::max(minMorselSize, idealMorselSize);
+}
+
+void FrontierMorselDispatcher::init(common::table_id_t _tableID, common::offset_t _numOffsets) {
+    tableID.store(_tableID);
+    numOffsets.store(_numOffsets);
+    nextOffset.store(0u);
+    sparseOffsets = nullptr;
+    morselSize = computeMorselSize(MIN_FRONTIER_MORSEL_SIZE);
+}
+
+void FrontierMorselDispatcher::initSparse(common::table_id_t _tableID,
+    const std::vector<common::offset_t>& offsets) {
+    tableID.store(_tableID);
+    numOffsets.store(offsets.size());
+    nextOffset.store(0u);
+    sparseOffsets = offsets.data();
+    morselSize = computeMorselSize(MIN_SPARSE_FRONTIER_MORSEL_SIZE);
 }
 
 bool FrontierMorselDispatcher::getNextRangeMorsel(FrontierMorsel& frontierMorsel) {
@@ -37,10 +53,53 @@ bool FrontierMorselDispatcher::getNextRangeMorsel(FrontierMorsel& frontierMorsel
             numOffsets.load(std::memory_order_relaxed) :
             beginOffset + morselSize;
     frontierMorsel.initMorsel(tableID.load(std::memory_order_relaxed), beginOffset,
-        endOffsetExclusive);
+        endOffsetExclusive, sparseOffsets);
     return true;
 }
 
+void SparseFrontier::disable() {
+    std::unique_lock<std::mutex> lck{mtx};
+    enabled = false;
+    offsetsMap.clear();
+}
+
+void SparseFrontier::addNodes(std::span<const common::nodeID_t> nodeIDs) {
+    std::unique_lock<std::mutex> lck{mtx};
+    if (!enabled) {
+        return;
+    }
+    if (numActiveNodes + nodeIDs.size() > maxNumActiveNodes) {
+        enabled = false;
+        offsetsMap.clear();
+        return;
+    }
+    numActiveNodes += nodeIDs.size();
+    for (const auto nodeID : nodeIDs) {
+        offsetsMap[nodeID.tableID].push_back(nodeID.offset);
+    }
+}
+
+void SparseFrontier::finalize() {
+    // Nodes can be set active multiple times within an iteration, both by the same thread and by
+    // different threads. Sorting also makes the following scans access the masks in order.
+    for (auto& [_, offsets] : offsetsMap) {
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+    }
+}
+
+void SparseFrontier::reset() {
+    enabled = true;
+    numActiveNodes = 0;
+    offsetsMap.clear();
+}
+
+const std::vector<common::offset_t>& SparseFrontier::getOffsets(common::table_id_t tableID) {
+    KU_ASSERT(enabled);
+    // Tables without any active node get an empty list.
+    return offsetsMap[tableID];
+}
+
 PathLengths::PathLengths(const common::table_id_map_t<common::offset_t>& numNodesMap_,
     storage::MemoryManager* mm)
     : GDSFrontier{numNodesMap_} {
@@ -80,6 +139,13 @@ FrontierPair::FrontierPair(std::shared_ptr<GDSFrontier> curFrontier,
     numApproxActiveNodesForCurIter.store(UINT64_MAX);
     numApproxActiveNodesForNextIter.store(initialActiveNodes);
     curIter.store(0u);
+    uint64_t totalNumNodes = 0;
+    for (const auto& [_, numNodes] : curFrontier->getNumNodesMap()) {
+        totalNumNodes += numNodes;
+    }
+    auto maxNumSparseActiveNodes = totalNumNodes / SPARSE_FRONTIER_DENSITY_RATIO;
+    curSparseFrontier = std::make_unique<SparseFrontier>(maxNumSparseActiveNodes);
+    nextSparseFrontier = std::make_unique<SparseFrontier>(maxNumSparseActiveNodes);
 }
 
 void FrontierPair::beginNewIteration() {
@@ -88,14 +154,26 @@ void FrontierPair::beginNewIteration() {
     numApproxActiveNodesForCurIter.store(numApproxActiveNodesForNextIter.load());
     numApproxActiveNodesForNextIter.store(0u);
     std::swap(curFrontier, nextFrontier);
+    std::swap(curSparseFrontier, nextSparseFrontier);
+    curSparseFrontier->finalize();
+    nextSparseFrontier->reset();
     beginNewIterationInternalNoLock();
 }
 
+void FrontierPair::initMorselDispatcher(FrontierMorselDispatcher& dispatcher, table_id_t tableID,
+    offset_t numOffsets) const {
+    if (curSparseFrontier->isEnabled()) {
+        dispatcher.initSparse(tableID, curSparseFrontier->getOffsets(tableID));
+    } else {
+        dispatcher.init(tableID, numOffsets);
+    }
+}
+
 void SinglePathLengthsFrontierPair::beginFrontierComputeBetweenTables(table_id_t curFrontierTableID,
     table_id_t nextFrontierTableID) {
     pathLengths->fixCurFrontierNodeTable(curFrontierTableID);
     pathLengths->fixNextFrontierNodeTable(nextFrontierTableID);
-    morselDispatcher.init(curFrontierTableID,
+    initMorselDispatcher(morselDispatcher, curFrontierTableID,
         pathLengths->getNumNodesInCurFrontierFixedNodeTable());
 }
 
@@ -106,6 +184,7 @@ bool SinglePathLengthsFrontierPair::getNextRangeMorsel(FrontierMorsel& frontierM
 void SinglePathLengthsFrontierPair::initRJFromSource(nodeID_t source) {
     pathLengths->fixNextFrontierNodeTable(source.tableID);
     pathLengths->setActive(source);
+    nextSparseFrontier->addNodes(std::span(&source, 1));
 }
 
 DoublePathLengthsFrontierPair::DoublePathLengthsFrontierPair(
@@ -125,13 +204,14 @@ void DoublePathLengthsFrontierPair::beginFrontierComputeBetweenTables(table_id_t
     table_id_t nextFrontierTableID) {
     curFrontier->ptrCast<PathLengths>()->fixCurFrontierNodeTable(curFrontierTableID);
     nextFrontier->ptrCast<PathLengths>()->fixNextFrontierNodeTable(nextFrontierTableID);
-    morselDispatcher->init(curFrontierTableID,
+    initMorselDispatcher(*morselDispatcher, curFrontierTableID,
         curFrontier->ptrCast<PathLengths>()->getNumNodesInCurFrontierFixedNodeTable());
 }
 
 void DoublePathLengthsFrontierPair::initRJFromSource(nodeID_t source) {
     nextFrontier->ptrCast<PathLengths>()->fixNextFrontierNodeTable(source.tableID);
     nextFrontier->ptrCast<PathLengths>()->setActive(source);
+    nextSparseFrontier->addNodes(std::span(&source, 1));
 }
 
 static constexpr uint64_t EARLY_TERM_NUM_NODES_THRESHOLD = 100;
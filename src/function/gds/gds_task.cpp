@@ -7,44 +7,165 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace function {
 
+// Buffers the nodes a worker thread activates for the next frontier as long as the next frontier
+// can still be sparse.
+struct SparseFrontierLocalState {
+    uint64_t maxNumActiveNodes;
+    std::vector<nodeID_t> activeNodes;
+
+    explicit SparseFrontierLocalState(uint64_t maxNumActiveNodes)
+        : maxNumActiveNodes{maxNumActiveNodes} {}
+
+    bool enabled() const { return maxNumActiveNodes > 0; }
+
+    void append(const std::vector<nodeID_t>& nodeIDs) {
+        if (!enabled()) {
+            return;
+        }
+        if (activeNodes.size() + nodeIDs.size() > maxNumActiveNodes) {
+            maxNumActiveNodes = 0;
+            activeNodes.clear();
+            return;
+        }
+        activeNodes.insert(activeNodes.end(), nodeIDs.begin(), nodeIDs.end());
+    }
+
+    void flush(FrontierPair& frontierPair) const {
+        if (enabled()) {
+            frontierPair.addSparseActiveNodes(activeNodes);
+        } else {
+            frontierPair.disableSparseNextFrontier();
+        }
+    }
+};
+
 static uint64_t computeScanResult(nodeID_t sourceNodeID, graph::GraphScanState::Chunk& chunk,
-    EdgeCompute& ec, FrontierPair& frontierPair, bool isFwd) {
+    EdgeCompute& ec, FrontierPair& frontierPair, SparseFrontierLocalState& sparseState,
+    bool isFwd) {
     auto activeNodes = ec.edgeCompute(sourceNodeID, chunk, isFwd);
     frontierPair.getNextFrontierUnsafe().setActive(activeNodes);
+    sparseState.append(activeNodes);
     return chunk.size();
 }
 
+bool FrontierTaskSharedState::trySplitHighDegreeNode(nodeID_t nodeID,
+    uint64_t numPersistentEdges) {
+    if (!enableEdgeRangeMorsels || numPersistentEdges <= highDegreeThreshold) {
+        return false;
+    }
+    {
+        std::unique_lock<std::mutex> lck{mtx};
+        for (uint64_t startRow = 0u; startRow < numPersistentEdges;
+             startRow += edgeRangeMorselSize) {
+            // The last range is left open so that it also covers edges appended to the list.
+            const auto endRow = startRow + edgeRangeMorselSize >= numPersistentEdges ?
+                                    INVALID_ROW_IDX :
+                                    startRow + edgeRangeMorselSize;
+            edgeRangeMorsels.push_back(EdgeRangeMorsel{nodeID, {startRow, endRow}});
+        }
+        numPendingEdgeRangeMorsels.store(edgeRangeMorsels.size());
+    }
+    cv.notify_all();
+    return true;
+}
+
+bool FrontierTaskSharedState::getNextEdgeRangeMorsel(EdgeRangeMorsel& morsel) {
+    std::unique_lock<std::mutex> lck{mtx};
+    if (edgeRangeMorsels.empty()) {
+        return false;
+    }
+    popEdgeRangeMorselNoLock(morsel);
+    return true;
+}
+
+bool FrontierTaskSharedState::waitForNextEdgeRangeMorsel(EdgeRangeMorsel& morsel) {
+    std::unique_lock<std::mutex> lck{mtx};
+    cv.wait(lck, [&] { return !edgeRangeMorsels.empty() || numThreadsScanningNodes == 0; });
+    if (edgeRangeMorsels.empty()) {
+        return false;
+    }
+    popEdgeRangeMorselNoLock(morsel);
+    return true;
+}
+
+void FrontierTaskSharedState::beginScanningNodes() {
+    std::unique_lock<std::mutex> lck{mtx};
+    numThreadsScanningNodes++;
+}
+
+void FrontierTaskSharedState::finishScanningNodes() {
+    std::unique_lock<std::mutex> lck{mtx};
+    if (--numThreadsScanningNodes == 0) {
+        // Wake up the threads waiting for edge range morsels, as no more can be added.
+        cv.notify_all();
+    }
+}
+
+void FrontierTaskSharedState::popEdgeRangeMorselNoLock(EdgeRangeMorsel& morsel) {
+    morsel = edgeRangeMorsels.back();
+    edgeRangeMorsels.pop_back();
+    numPendingEdgeRangeMorsels.store(edgeRangeMorsels.size());
+}
+
+graph::Graph::Iterator FrontierTask::scan(nodeID_t nodeID, graph::GraphScanState& scanState,
+    const graph::PersistentEdgeRange& range) const {
+    switch (info.direction) {
+    case ExtendDirection::FWD:
+        return info.graph->scanFwd(nodeID, scanState, range);
+    case ExtendDirection::BWD:
+        return info.graph->scanBwd(nodeID, scanState, range);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
 void FrontierTask::run() {
     FrontierMorsel frontierMorsel;
-    auto numApproxActiveNodesForNextIter = 0u;
-    auto graph = info.graph;
-    auto scanState = graph->prepareScan(info.relTableIDToScan);
+    uint64_t numApproxActiveNodesForNextIter = 0u;
+    auto scanState = info.graph->prepareScan(info.relTableIDToScan);
     auto localEc = info.edgeCompute.copy();
+    auto sparseState =
+        SparseFrontierLocalState(sharedState->frontierPair.getMaxNumSparseActiveNodes());
+    const auto isFwd = info.direction == ExtendDirection::FWD;
+    auto computeNode = [&](nodeID_t nodeID, graph::Graph::Iterator iter) {
+        for (auto chunk : iter) {
+            numApproxActiveNodesForNextIter += computeScanResult(nodeID, chunk, *localEc,
+                sharedState->frontierPair, sparseState, isFwd);
+        }
+    };
+    auto computeEdgeRangeMorsels = [&]() {
+        EdgeRangeMorsel edgeRangeMorsel;
+        while (sharedState->getNextEdgeRangeMorsel(edgeRangeMorsel)) {
+            computeNode(edgeRangeMorsel.nodeID,
+                scan(edgeRangeMorsel.nodeID, *scanState, edgeRangeMorsel.range));
+        }
+    };
+    sharedState->beginScanningNodes();
     while (sharedState->frontierPair.getNextRangeMorsel(frontierMorsel)) {
         while (frontierMorsel.hasNextOffset()) {
             common::nodeID_t nodeID = frontierMorsel.getNextNodeID();
             if (sharedState->frontierPair.curFrontier->isActive(nodeID.offset)) {
-                switch (info.direction) {
-                case ExtendDirection::FWD: {
-                    for (auto chunk : graph->scanFwd(nodeID, *scanState)) {
-                        numApproxActiveNodesForNextIter += computeScanResult(nodeID, chunk,
-                            *localEc, sharedState->frontierPair, true);
-                    }
-                } break;
-                case ExtendDirection::BWD: {
-                    for (auto chunk : graph->scanBwd(nodeID, *scanState)) {
-                        numApproxActiveNodesForNextIter += computeScanResult(nodeID, chunk,
-                            *localEc, sharedState->frontierPair, false);
-                    }
-                } break;
-                default:
-                    KU_UNREACHABLE;
+                auto iter = scan(nodeID, *scanState, graph::PersistentEdgeRange{});
+                if (!sharedState->trySplitHighDegreeNode(nodeID,
+                        scanState->getNumPersistentEdges())) {
+                    computeNode(nodeID, iter);
                 }
             }
+            if (sharedState->hasPendingEdgeRangeMorsels()) {
+                computeEdgeRangeMorsels();
+            }
         }
     }
+    sharedState->finishScanningNodes();
+    // Help scanning high-degree nodes until no thread can split more of them.
+    EdgeRangeMorsel edgeRangeMorsel;
+    while (sharedState->waitForNextEdgeRangeMorsel(edgeRangeMorsel)) {
+        computeNode(edgeRangeMorsel.nodeID,
+            scan(edgeRangeMorsel.nodeID, *scanState, edgeRangeMorsel.range));
+    }
     sharedState->frontierPair.incrementApproxActiveNodesForNextIter(
         numApproxActiveNodesForNextIter);
+    sparseState.flush(sharedState->frontierPair);
 }
 
 void VertexComputeTask::run() {
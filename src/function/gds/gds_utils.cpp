@@ -18,9 +18,10 @@ static void scheduleFrontierTask(table_id_t relTableID, graph::Graph* graph,
     processor::ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto info = FrontierTaskInfo(relTableID, graph, extendDirection, *rjCompState.edgeCompute);
-    auto sharedState = std::make_shared<FrontierTaskSharedState>(*rjCompState.frontierPair);
     auto maxThreads =
         clientContext->getCurrentSetting(main::ThreadsSetting::name).getValue<uint64_t>();
+    auto sharedState = std::make_shared<FrontierTaskSharedState>(*rjCompState.frontierPair,
+        maxThreads, clientContext->getClientConfig()->gdsHighDegreeThreshold);
     auto task = std::make_shared<FrontierTask>(maxThreads, info, sharedState);
     // GDSUtils::runFrontiersUntilConvergence is called from a GDSCall operator, which is
     // already executed by a worker thread Tm of the task scheduler. So this function is
@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <atomic>
+
+#include "binder/binder.h"
+#include "common/exception/interrupt.h"
+#include "common/types/types.h"
+#include "function/gds/gds.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds_function.h"
+#include "graph/graph.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+// Triangles are counted on the undirected simple graph underlying the projected graph, i.e., edge
+// directions and parallel edges are ignored and self-loops are dropped. Nodes of all node tables
+// are mapped to dense indices [0, numNodes) so that per-node state is kept in flat arrays.
+//
+// Each edge {u, v} is oriented from the lower ranked node to the higher ranked node, where nodes
+// are ranked by degree (ties broken by index). Every triangle is then found exactly once, by
+// intersecting the oriented neighbour lists of the endpoints of its lowest ranked edge, and each
+// oriented list has at most O(sqrt(numEdges)) entries, which bounds the cost of hub nodes.
+class TriangleCountState {
+public:
+    TriangleCountState(main::ClientContext* context, Graph* graph) {
+        numNodes = 0;
+        for (auto tableID : graph->getNodeTableIDs()) {
+            tableStartIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(context->getTx(), tableID);
+        }
+        degrees.resize(numNodes, 0);
+        orientedOffsets.resize(numNodes + 1, 0);
+        numTriangles = std::make_unique<std::atomic<uint64_t>[]>(numNodes);
+    }
+    DELETE_COPY_AND_MOVE(TriangleCountState);
+
+    // Rel tables of the projected graph may point to node tables that are not projected.
+    bool isInGraph(nodeID_t nodeID) const { return tableStartIdx.contains(nodeID.tableID); }
+    uint64_t getNodeIdx(nodeID_t nodeID) const {
+        return tableStartIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    void setDegree(uint64_t nodeIdx, uint64_t degree) { degrees[nodeIdx] = degree; }
+    uint64_t getDegree(uint64_t nodeIdx) const { return degrees[nodeIdx]; }
+    bool isHigherRanked(uint64_t nodeIdx, uint64_t otherIdx) const {
+        return degrees[otherIdx] > degrees[nodeIdx] ||
+               (degrees[otherIdx] == degrees[nodeIdx] && otherIdx > nodeIdx);
+    }
+
+    // Before finalizeOrientedOffsets(), orientedOffsets[i + 1] holds the number of oriented
+    // neighbours of node i. Afterwards, orientedOffsets[i] is the start of its list.
+    void setNumOrientedNbrs(uint64_t nodeIdx, uint64_t numNbrs) {
+        orientedOffsets[nodeIdx + 1] = numNbrs;
+    }
+    void finalizeOrientedOffsets() {
+        for (auto i = 0u; i < numNodes; ++i) {
+            orientedOffsets[i + 1] += orientedOffsets[i];
+        }
+        orientedNbrs.resize(orientedOffsets[numNodes]);
+    }
+    void setOrientedNbrs(uint64_t nodeIdx, const std::vector<uint64_t>& nbrs) {
+        KU_ASSERT(orientedOffsets[nodeIdx + 1] - orientedOffsets[nodeIdx] == nbrs.size());
+        std::copy(nbrs.begin(), nbrs.end(), orientedNbrs.begin() + orientedOffsets[nodeIdx]);
+    }
+    std::span<const uint64_t> getOrientedNbrs(uint64_t nodeIdx) const {
+        return std::span<const uint64_t>(orientedNbrs.data() + orientedOffsets[nodeIdx],
+            orientedOffsets[nodeIdx + 1] - orientedOffsets[nodeIdx]);
+    }
+
+    void addTriangles(uint64_t nodeIdx, uint64_t num) {
+        numTriangles[nodeIdx].fetch_add(num, std::memory_order_relaxed);
+    }
+    uint64_t getNumTriangles(uint64_t nodeIdx) const {
+        return numTriangles[nodeIdx].load(std::memory_order_relaxed);
+    }
+
+private:
+    table_id_map_t<uint64_t> tableStartIdx;
+    uint64_t numNodes;
+    std::vector<uint64_t> degrees;
+    std::vector<uint64_t> orientedOffsets;
+    std::vector<uint64_t> orientedNbrs;
+    std::unique_ptr<std::atomic<uint64_t>[]> numTriangles;
+};
+
+// Calls func on each value that is contained in both of the sorted lists. If one list is much
+// shorter than the other, each of its values is searched for with an exponential search in the
+// longer list. Otherwise the lists are merged, advancing both cursors without branching on which
+// side is smaller.
+template<typename Func>
+static void intersectSorted(std::span<const uint64_t> left, std::span<const uint64_t> right,
+    Func&& func) {
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
+    if (left.size() > right.size()) {
+        std::swap(left, right);
+    }
+    if (left.empty()) {
+        return;
+    }
+    if (left.size() * GALLOPING_SIZE_RATIO < right.size()) {
+        uint64_t pos = 0;
+        for (auto value : left) {
+            uint64_t step = 1;
+            while (pos + step < right.size() && right[pos + step] < value) {
+                pos += step;
+                step *= 2;
+            }
+            auto end = std::min<uint64_t>(pos + step + 1, right.size());
+            pos = std::lower_bound(right.begin() + pos, right.begin() + end, value) - right.begin();
+            if (pos == right.size()) {
+                return;
+            }
+            if (right[pos] == value) {
+                func(value);
+            }
+        }
+        return;
+    }
+    uint64_t i = 0, j = 0;
+    while (i < left.size() && j < right.size()) {
+        auto leftValue = left[i];
+        auto rightValue = right[j];
+        if (leftValue == rightValue) {
+            func(leftValue);
+        }
+        i += leftValue <= rightValue;
+        j += rightValue <= leftValue;
+    }
+}
+
+class TriangleCountVertexCompute : public VertexCompute {
+public:
+    enum class Phase : uint8_t {
+        COMPUTE_DEGREES = 0,
+        COUNT_ORIENTED_NBRS = 1,
+        COLLECT_ORIENTED_NBRS = 2,
+        COUNT_TRIANGLES = 3,
+    };
+
+    TriangleCountVertexCompute(Graph* graph, TriangleCountState& state, Phase phase)
+        : graph{graph}, state{state}, phase{phase} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        fwdScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        bwdScanState = graph->prepareMultiTableScanBwd(nodeTableIDs);
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = state.getNodeIdx(nodeID);
+        switch (phase) {
+        case Phase::COMPUTE_DEGREES: {
+            collectNbrs(nodeID, nodeIdx);
+            state.setDegree(nodeIdx, nbrs.size());
+        } break;
+        case Phase::COUNT_ORIENTED_NBRS: {
+            collectOrientedNbrs(nodeID, nodeIdx);
+            state.setNumOrientedNbrs(nodeIdx, nbrs.size());
+        } break;
+        case Phase::COLLECT_ORIENTED_NBRS: {
+            collectOrientedNbrs(nodeID, nodeIdx);
+            state.setOrientedNbrs(nodeIdx, nbrs);
+        } break;
+        case Phase::COUNT_TRIANGLES: {
+            countTriangles(nodeIdx);
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountVertexCompute>(graph, state, phase);
+    }
+
+private:
+    // Collects the sorted, distinct neighbour indices of a node, ignoring edge directions.
+    void collectNbrs(nodeID_t nodeID, uint64_t nodeIdx) {
+        nbrs.clear();
+        auto collect = [&](Graph::Iterator iter) {
+            for (const auto chunk : iter) {
+                chunk.forEach([&](auto nbrNodeID, auto) {
+                    if (!state.isInGraph(nbrNodeID)) {
+                        return;
+                    }
+                    auto nbrIdx = state.getNodeIdx(nbrNodeID);
+                    if (nbrIdx != nodeIdx) {
+                        nbrs.push_back(nbrIdx);
+                    }
+                });
+            }
+        };
+        collect(graph->scanFwd(nodeID, *fwdScanState));
+        collect(graph->scanBwd(nodeID, *bwdScanState));
+        std::sort(nbrs.begin(), nbrs.end());
+        nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+    }
+
+    void collectOrientedNbrs(nodeID_t nodeID, uint64_t nodeIdx) {
+        collectNbrs(nodeID, nodeIdx);
+        std::erase_if(nbrs,
+            [&](uint64_t nbrIdx) { return !state.isHigherRanked(nodeIdx, nbrIdx); });
+    }
+
+    void countTriangles(uint64_t nodeIdx) {
+        auto nodeNbrs = state.getOrientedNbrs(nodeIdx);
+        uint64_t numTriangles = 0;
+        for (auto nbrIdx : nodeNbrs) {
+            uint64_t numTrianglesOfEdge = 0;
+            intersectSorted(nodeNbrs, state.getOrientedNbrs(nbrIdx), [&](uint64_t thirdIdx) {
+                state.addTriangles(thirdIdx, 1);
+                numTrianglesOfEdge++;
+            });
+            if (numTrianglesOfEdge > 0) {
+                state.addTriangles(nbrIdx, numTrianglesOfEdge);
+                numTriangles += numTrianglesOfEdge;
+            }
+        }
+        if (numTriangles > 0) {
+            state.addTriangles(nodeIdx, numTriangles);
+        }
+    }
+
+private:
+    Graph* graph;
+    TriangleCountState& state;
+    Phase phase;
+    std::unique_ptr<GraphScanState> fwdScanState;
+    std::unique_ptr<GraphScanState> bwdScanState;
+    std::vector<uint64_t> nbrs;
+};
+
+class TriangleCountOutputVertexCompute : public VertexCompute {
+public:
+    TriangleCountOutputVertexCompute(main::ClientContext* context, GDSCallSharedState* sharedState,
+        const TriangleCountState& state, bool outputClusteringCoefficient)
+        : context{context}, sharedState{sharedState}, state{state},
+          outputClusteringCoefficient{outputClusteringCoefficient} {
+        auto mm = context->getMemoryManager();
+        localFT = sharedState->claimLocalTable(mm);
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        if (outputClusteringCoefficient) {
+            valueVector = std::make_unique<ValueVector>(LogicalType::DOUBLE(), mm);
+        } else {
+            valueVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
+        }
+        valueVector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(nodeIDVector.get());
+        vectors.push_back(valueVector.get());
+    }
+    ~TriangleCountOutputVertexCompute() override { sharedState->returnLocalTable(localFT); }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = state.getNodeIdx(nodeID);
+        auto numTriangles = state.getNumTriangles(nodeIdx);
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        if (outputClusteringCoefficient) {
+            auto degree = state.getDegree(nodeIdx);
+            auto coefficient = 0.0;
+            if (degree > 1) {
+                coefficient = 2.0 * numTriangles / ((double)degree * (degree - 1));
+            }
+            valueVector->setValue<double>(0, coefficient);
+        } else {
+            valueVector->setValue<int64_t>(0, numTriangles);
+        }
+        localFT->append(vectors);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountOutputVertexCompute>(context, sharedState, state,
+            outputClusteringCoefficient);
+    }
+
+private:
+    main::ClientContext* context;
+    GDSCallSharedState* sharedState;
+    const TriangleCountState& state;
+    bool outputClusteringCoefficient;
+    FactorizedTable* localFT;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> valueVector;
+    std::vector<ValueVector*> vectors;
+};
+
+class TriangleCount final : public GDSAlgorithm {
+    static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+    static constexpr char CLUSTERING_COEFFICIENT_COLUMN_NAME[] = "local_clustering_coefficient";
+
+public:
+    explicit TriangleCount(bool outputClusteringCoefficient)
+        : outputClusteringCoefficient{outputClusteringCoefficient} {}
+    TriangleCount(const TriangleCount& other)
+        : GDSAlgorithm{other}, outputClusteringCoefficient{other.outputClusteringCoefficient} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     */
+    std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        return {LogicalTypeID::ANY};
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * triangle_count::INT64 or local_clustering_coefficient::DOUBLE
+     */
+    binder::expression_vector getResultColumns(binder::Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        if (outputClusteringCoefficient) {
+            columns.push_back(
+                binder->createVariable(CLUSTERING_COEFFICIENT_COLUMN_NAME, LogicalType::DOUBLE()));
+        } else {
+            columns.push_back(
+                binder->createVariable(TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+        }
+        return columns;
+    }
+
+    void bind(const expression_vector&, Binder* binder, GraphEntry& graphEntry) override {
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<GDSBindData>(nodeOutput);
+    }
+
+    void exec(processor::ExecutionContext* context) override {
+        auto clientContext = context->clientContext;
+        auto graph = sharedState->graph.get();
+        TriangleCountState state{clientContext, graph};
+        for (auto phase : {TriangleCountVertexCompute::Phase::COMPUTE_DEGREES,
+                 TriangleCountVertexCompute::Phase::COUNT_ORIENTED_NBRS,
+                 TriangleCountVertexCompute::Phase::COLLECT_ORIENTED_NBRS,
+                 TriangleCountVertexCompute::Phase::COUNT_TRIANGLES}) {
+            if (clientContext->interrupted()) {
+                throw InterruptException{};
+            }
+            if (phase == TriangleCountVertexCompute::Phase::COLLECT_ORIENTED_NBRS) {
+                state.finalizeOrientedOffsets();
+            }
+            TriangleCountVertexCompute vertexCompute{graph, state, phase};
+            GDSUtils::runVertexComputeIteration(context, graph, vertexCompute);
+        }
+        TriangleCountOutputVertexCompute outputVertexCompute{clientContext, sharedState.get(),
+            state, outputClusteringCoefficient};
+        GDSUtils::runVertexComputeIteration(context, graph, outputVertexCompute);
+        sharedState->mergeLocalTables();
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<TriangleCount>(*this);
+    }
+
+private:
+    bool outputClusteringCoefficient;
+};
+
+function_set TriangleCountFunction::getFunctionSet() {
+    function_set result;
+    auto algo = std::make_unique<TriangleCount>(false /* outputClusteringCoefficient */);
+    auto function =
+        std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo));
+    result.push_back(std::move(function));
+    return result;
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    function_set result;
+    auto algo = std::make_unique<TriangleCount>(true /* outputClusteringCoefficient */);
+    auto function =
+        std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo));
+    result.push_back(std::move(function));
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,64 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/statement_cache.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct StatementCacheInfoBindData : public CallTableFuncBindData {
+    uint64_t numEntries;
+    uint64_t numHits;
+    uint64_t numMisses;
+
+    StatementCacheInfoBindData(uint64_t numEntries, uint64_t numHits, uint64_t numMisses,
+        std::vector<LogicalType> columnTypes, std::vector<std::string> columnNames)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames),
+              1 /* one row result */},
+          numEntries{numEntries}, numHits{numHits}, numMisses{numMisses} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<StatementCacheInfoBindData>(numEntries, numHits, numMisses,
+            LogicalType::copy(columnTypes), columnNames);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    const auto bindData = input.bindData->constPtrCast<StatementCacheInfoBindData>();
+    auto pos = dataChunk.state->getSelVector()[0];
+    dataChunk.getValueVectorMutable(0).setValue(pos, bindData->numEntries);
+    dataChunk.getValueVectorMutable(1).setValue(pos, bindData->numHits);
+    dataChunk.getValueVectorMutable(2).setValue(pos, bindData->numMisses);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames{"num_entries", "num_hits", "num_misses"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::UINT64());
+    auto statementCache = context->getDatabase()->getStatementCache();
+    return std::make_unique<StatementCacheInfoBindData>(statementCache->getNumEntries(),
+        statementCache->getNumHits(), statementCache->getNumMisses(), std::move(columnTypes),
+        std::move(columnNames));
+}
+
+function_set StatementCacheInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
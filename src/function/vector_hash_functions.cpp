@@ -1,5 +1,7 @@
 #include "function/hash/vector_hash_functions.h"
 
+#include <array>
+
 #include "common/type_utils.h"
 #include "function/hash/hash_functions.h"
 #include "function/scalar_function.h"
@@ -118,6 +120,58 @@ void BinaryHashFunctionExecutor::execute(const common::ValueVector& left,
     }
 }
 
+namespace {
+
+// Strings scanned from the same dictionary entry of a string column share one overflow buffer, so
+// the buffer identifies the dictionary entry. The hash of a long string is computed once per
+// buffer and reused for the other values pointing to it.
+class StringHashCache {
+    static constexpr uint64_t NUM_ENTRIES = 64;
+
+    struct Entry {
+        uint64_t overflowPtr = 0;
+        uint32_t len = 0;
+        hash_t hash = 0;
+    };
+
+public:
+    hash_t getHash(const ku_string_t& str) {
+        hash_t hash = 0;
+        if (ku_string_t::isShortString(str.len)) {
+            Hash::operation(str, hash);
+            return hash;
+        }
+        auto& entry = entries[(str.overflowPtr >> 3) % NUM_ENTRIES];
+        if (entry.overflowPtr == str.overflowPtr && entry.len == str.len) {
+            return entry.hash;
+        }
+        Hash::operation(str, hash);
+        entry = Entry{str.overflowPtr, str.len, hash};
+        return hash;
+    }
+
+private:
+    std::array<Entry, NUM_ENTRIES> entries{};
+};
+
+} // namespace
+
+static void computeStringVecHash(const ValueVector& operand,
+    const SelectionVector& operandSelectVec, ValueVector& result,
+    const SelectionVector& resultSelectVec) {
+    StringHashCache cache;
+    auto resultValues = reinterpret_cast<hash_t*>(result.getData());
+    for (auto i = 0u; i < operandSelectVec.getSelSize(); i++) {
+        const auto operandPos = operandSelectVec[i];
+        const auto resultPos = resultSelectVec[i];
+        if (operand.isNull(operandPos)) {
+            resultValues[resultPos] = NULL_HASH;
+        } else {
+            resultValues[resultPos] = cache.getHash(operand.getValue<ku_string_t>(operandPos));
+        }
+    }
+}
+
 static std::unique_ptr<ValueVector> computeDataVecHash(const ValueVector& operand) {
     auto hashVector = std::make_unique<ValueVector>(LogicalType::LIST(LogicalType::HASH()));
     auto numValuesInDataVec = ListVector::getDataVectorSize(&operand);
@@ -210,6 +264,9 @@ void VectorHashFunction::computeHash(const ValueVector& operand,
             UnaryHashFunctionExecutor::execute<T, hash_t>(operand, operandSelectVec, result,
                 resultSelectVec);
         },
+        [&](ku_string_t) {
+            computeStringVecHash(operand, operandSelectVec, result, resultSelectVec);
+        },
         [&](struct_entry_t) {
             computeStructVecHash(operand, operandSelectVec, result, resultSelectVec);
         },
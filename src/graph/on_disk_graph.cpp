@@ -74,7 +74,7 @@ static std::unique_ptr<RelTableScanState> getRelScanState(
 
 OnDiskGraphScanStates::OnDiskGraphScanStates(ClientContext* context, std::span<RelTable*> tables,
     const GraphEntry& graphEntry, std::optional<idx_t> edgePropertyIndex)
-    : iteratorIndex{0}, direction{RelDataDirection::INVALID} {
+    : iteratorIndex{0}, direction{RelDataDirection::INVALID}, numPersistentEdges{0} {
     auto schema = graphEntry.getRelPropertiesSchema();
     auto descriptor = ResultSetDescriptor(&schema);
     auto resultSet = ResultSet(&descriptor, context->getMemoryManager());
@@ -240,32 +240,38 @@ std::unique_ptr<GraphScanState> OnDiskGraph::prepareMultiTableScanBwd(
         new OnDiskGraphScanStates(context, std::span(tables), graphEntry));
 }
 
-Graph::Iterator OnDiskGraph::scanFwd(nodeID_t nodeID, GraphScanState& state) {
+Graph::Iterator OnDiskGraph::scanFwd(nodeID_t nodeID, GraphScanState& state,
+    const PersistentEdgeRange& range) {
     auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphScanStates&>(state);
     onDiskScanState.srcNodeIDVector->setValue<nodeID_t>(0, nodeID);
     onDiskScanState.dstNodeIDVector->state->getSelVectorUnsafe().setSelSize(0);
     KU_ASSERT(nodeTableIDToFwdRelTables.contains(nodeID.tableID));
     auto& relTables = nodeTableIDToFwdRelTables.at(nodeID.tableID);
+    onDiskScanState.numPersistentEdges = 0;
     for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
         auto relTablePair = relTables.find(tableID);
         if (relTablePair != relTables.end()) {
-            scanState.fwdIterator.initScan();
+            scanState.fwdIterator.initScan(range);
+            onDiskScanState.numPersistentEdges += scanState.fwdIterator.getNumPersistentEdges();
         }
     }
     onDiskScanState.startScan(common::RelDataDirection::FWD);
     return Graph::Iterator(&onDiskScanState);
 }
 
-Graph::Iterator OnDiskGraph::scanBwd(nodeID_t nodeID, GraphScanState& state) {
+Graph::Iterator OnDiskGraph::scanBwd(nodeID_t nodeID, GraphScanState& state,
+    const PersistentEdgeRange& range) {
     auto& onDiskScanState = ku_dynamic_cast<OnDiskGraphScanStates&>(state);
     onDiskScanState.srcNodeIDVector->setValue<nodeID_t>(0, nodeID);
     onDiskScanState.dstNodeIDVector->state->getSelVectorUnsafe().setSelSize(0);
     KU_ASSERT(nodeTableIDToBwdRelTables.contains(nodeID.tableID));
     auto& relTables = nodeTableIDToBwdRelTables.at(nodeID.tableID);
+    onDiskScanState.numPersistentEdges = 0;
     for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
         auto relTablePair = relTables.find(tableID);
         if (relTablePair != relTables.end()) {
-            scanState.bwdIterator.initScan();
+            scanState.bwdIterator.initScan(range);
+            onDiskScanState.numPersistentEdges += scanState.bwdIterator.getNumPersistentEdges();
         }
     }
     onDiskScanState.startScan(common::RelDataDirection::BWD);
@@ -291,7 +297,8 @@ OnDiskGraphScanState::InnerIterator::InnerIterator(const main::ClientContext* co
     storage::RelTable* relTable, std::unique_ptr<storage::RelTableScanState> tableScanState)
     : context{context}, relTable{relTable}, tableScanState{std::move(tableScanState)} {}
 
-void OnDiskGraphScanState::InnerIterator::initScan() {
+void OnDiskGraphScanState::InnerIterator::initScan(const PersistentEdgeRange& range) {
+    tableScanState->setPersistentRowRange(range.startRow, range.endRow);
     relTable->initScanState(context->getTx(), *tableScanState);
 }
 
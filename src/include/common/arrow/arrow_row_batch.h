@@ -51,6 +51,15 @@ public:
     ArrowArray append(main::QueryResult& queryResult, std::int64_t chunkSize);
 
 private:
+    // Results whose columns are all flat and have a primitive or string type are copied straight
+    // from the factorized table, one column at a time, instead of through FlatTuples.
+    static bool canAppendColumnar(main::QueryResult& queryResult,
+        const std::vector<LogicalType>& types);
+    std::int64_t appendColumnar(main::QueryResult& queryResult, std::int64_t chunkSize);
+    static void copyColumn(ArrowVector* vector, const LogicalType& type,
+        const processor::FactorizedTable& table, uint32_t colIdx, uint64_t startTupleIdx,
+        std::int64_t numTuples);
+
     static std::unique_ptr<ArrowVector> createVector(const LogicalType& type,
         std::int64_t capacity);
     static void appendValue(ArrowVector* vector, const LogicalType& type, Value* value);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 
 #include "common/api.h"
@@ -11,6 +12,14 @@ namespace common {
 
 class FileSystem;
 
+// A read into, or a write from, buffer of numBytes at offset in a file. Batches of requests are
+// handed to the file system together so that it can merge requests on adjacent ranges.
+struct FileIORequest {
+    uint8_t* buffer;
+    uint64_t numBytes;
+    uint64_t offset;
+};
+
 struct KUZU_API FileInfo {
     FileInfo(std::string path, FileSystem* fileSystem)
         : path{std::move(path)}, fileSystem{fileSystem} {}
@@ -25,6 +34,11 @@ struct KUZU_API FileInfo {
 
     void writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset);
 
+    // Perform all requests and return once they are done. Requests on the same range are applied
+    // in the given order.
+    void readFromFileBatch(std::span<const FileIORequest> requests);
+    void writeFileBatch(std::span<const FileIORequest> requests);
+
     void syncFile() const;
 
     int64_t seek(uint64_t offset, int whence);
@@ -87,6 +87,12 @@ protected:
     virtual void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const;
 
+    // By default, requests are performed one at a time.
+    virtual void readFromFileBatch(FileInfo& fileInfo,
+        std::span<const FileIORequest> requests) const;
+
+    virtual void writeFileBatch(FileInfo& fileInfo, std::span<const FileIORequest> requests) const;
+
     virtual int64_t seek(FileInfo& fileInfo, uint64_t offset, int whence) const = 0;
 
     virtual void truncate(FileInfo& fileInfo, uint64_t size) const;
@@ -59,6 +59,12 @@ protected:
     void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const override;
 
+    void readFromFileBatch(FileInfo& fileInfo,
+        std::span<const FileIORequest> requests) const override;
+
+    void writeFileBatch(FileInfo& fileInfo,
+        std::span<const FileIORequest> requests) const override;
+
     int64_t seek(FileInfo& fileInfo, uint64_t offset, int whence) const override;
 
     void truncate(FileInfo& fileInfo, uint64_t size) const override;
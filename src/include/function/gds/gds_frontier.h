@@ -65,19 +65,27 @@ public:
 
     bool hasNextOffset() const { return nextOffset < endOffsetExclusive; }
 
-    common::nodeID_t getNextNodeID() { return {nextOffset++, tableID}; }
+    // If the morsel is sparse, [beginOffset, endOffsetExclusive) is a range of positions in
+    // sparseOffsets instead of a range of node offsets.
+    common::nodeID_t getNextNodeID() {
+        auto offset = sparseOffsets == nullptr ? nextOffset : sparseOffsets[nextOffset];
+        nextOffset++;
+        return {offset, tableID};
+    }
 
 protected:
     void initMorsel(common::table_id_t _tableID, common::offset_t _beginOffset,
-        common::offset_t _endOffsetExclusive) {
+        common::offset_t _endOffsetExclusive, const common::offset_t* _sparseOffsets = nullptr) {
         tableID = _tableID;
         beginOffset = _beginOffset;
         endOffsetExclusive = _endOffsetExclusive;
         nextOffset = beginOffset;
+        sparseOffsets = _sparseOffsets;
     }
 
 private:
     common::table_id_t tableID = common::INVALID_TABLE_ID;
+    const common::offset_t* sparseOffsets = nullptr;
     common::offset_t beginOffset = common::INVALID_OFFSET;
     common::offset_t endOffsetExclusive = common::INVALID_OFFSET;
     common::offset_t nextOffset = common::INVALID_OFFSET;
@@ -89,22 +97,67 @@ class FrontierMorselDispatcher {
     // can have fewer than this. See the beginFrontierComputeBetweenTables to see the actual
     // morselSize computation for details.
     static constexpr uint64_t MIN_NUMBER_OF_FRONTIER_MORSELS = 128;
+    // Each offset of a sparse morsel is (almost always) an active node whose edges will be
+    // scanned, so sparse morsels are kept much smaller than dense ones.
+    static constexpr uint64_t MIN_SPARSE_FRONTIER_MORSEL_SIZE = 8;
 
 public:
     explicit FrontierMorselDispatcher(uint64_t _maxThreadsForExec);
 
     void init(common::table_id_t _tableID, common::offset_t _numOffsets);
+    // Dispatches morsels over the given (sorted) list of node offsets instead of over the
+    // [0, numOffsets) range. The list must outlive the morsels given out.
+    void initSparse(common::table_id_t _tableID, const std::vector<common::offset_t>& offsets);
 
     bool getNextRangeMorsel(FrontierMorsel& frontierMorsel);
 
+private:
+    uint64_t computeMorselSize(uint64_t minMorselSize) const;
+
 private:
     std::atomic<uint64_t> maxThreadsForExec;
     std::atomic<common::table_id_t> tableID;
     std::atomic<common::offset_t> numOffsets;
     std::atomic<common::offset_t> nextOffset;
+    const common::offset_t* sparseOffsets;
     uint64_t morselSize;
 };
 
+/**
+ * Sparse representation of the active nodes of a frontier: a sorted list of active offsets per
+ * node table. A SparseFrontier is only kept while the number of active nodes stays below
+ * maxNumActiveNodes. Once that threshold is exceeded, the sparse frontier is disabled and callers
+ * should fall back to scanning the dense masks of the GDSFrontier.
+ *
+ * Worker threads collect the nodes they activate in thread-local buffers and merge them at the end
+ * of their task, so the only synchronization is a single lock acquisition per task.
+ */
+class SparseFrontier {
+public:
+    explicit SparseFrontier(uint64_t maxNumActiveNodes)
+        : maxNumActiveNodes{maxNumActiveNodes}, numActiveNodes{0}, enabled{true} {}
+
+    bool isEnabled() const { return enabled; }
+    uint64_t getMaxNumActiveNodes() const { return maxNumActiveNodes; }
+
+    // Thread-safe.
+    void disable();
+    // Thread-safe. Disables the sparse frontier if the nodes do not fit.
+    void addNodes(std::span<const common::nodeID_t> nodeIDs);
+    // Sorts and removes duplicate offsets. Should be called once all nodes have been added.
+    void finalize();
+    void reset();
+
+    const std::vector<common::offset_t>& getOffsets(common::table_id_t tableID);
+
+private:
+    std::mutex mtx;
+    uint64_t maxNumActiveNodes;
+    uint64_t numActiveNodes;
+    bool enabled;
+    common::table_id_map_t<std::vector<common::offset_t>> offsetsMap;
+};
+
 /**
  * Interface for maintaining a frontier of nodes for GDS algorithms. The frontier is a set of
  * "active nodes" for which some computation should be done at a particular iteration of a
@@ -272,7 +325,27 @@ public:
     // Note: If the implementing class stores 2 frontierPair, this function should swap them.
     virtual void beginNewIterationInternalNoLock() {}
 
+    // Returns the maximum number of nodes a worker thread should buffer locally before giving up
+    // on a sparse next frontier, or 0 if the next frontier is already known to be dense.
+    uint64_t getMaxNumSparseActiveNodes() const {
+        return nextSparseFrontier->isEnabled() ? nextSparseFrontier->getMaxNumActiveNodes() : 0;
+    }
+    void addSparseActiveNodes(std::span<const common::nodeID_t> nodeIDs) {
+        nextSparseFrontier->addNodes(nodeIDs);
+    }
+    void disableSparseNextFrontier() { nextSparseFrontier->disable(); }
+
 protected:
+    // Initializes the morsel dispatcher to iterate over the sparse list of active nodes of the
+    // current frontier if there is one, and over all offsets of the table otherwise.
+    void initMorselDispatcher(FrontierMorselDispatcher& dispatcher, common::table_id_t tableID,
+        common::offset_t numOffsets) const;
+
+protected:
+    // A frontier is kept sparse while it holds at most 1/SPARSE_FRONTIER_DENSITY_RATIO of the
+    // nodes of the graph.
+    static constexpr uint64_t SPARSE_FRONTIER_DENSITY_RATIO = 64;
+
     std::mutex mtx;
     // curIter is the iteration number of the algorithm and starts from 0.
     std::atomic<uint16_t> curIter;
@@ -286,6 +359,8 @@ protected:
     std::atomic<uint64_t> numApproxActiveNodesForNextIter;
     std::shared_ptr<GDSFrontier> curFrontier;
     std::shared_ptr<GDSFrontier> nextFrontier;
+    std::unique_ptr<SparseFrontier> curSparseFrontier;
+    std::unique_ptr<SparseFrontier> nextSparseFrontier;
     uint64_t maxThreadsForExec;
 };
 
@@ -52,5 +52,17 @@ struct PageRankFunction {
     static function_set getFunctionSet();
 };
 
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientFunction {
+    static constexpr const char* name = "LOCAL_CLUSTERING_COEFFICIENT";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
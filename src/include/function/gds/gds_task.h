@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+
 #include "common/enums/extend_direction.h"
 #include "common/task_system/task.h"
 #include "function/gds/gds_frontier.h"
@@ -22,11 +25,56 @@ struct FrontierTaskInfo {
           edgeCompute{other.edgeCompute} {}
 };
 
+// A range of the persistent adjacency list of a single high-degree node.
+struct EdgeRangeMorsel {
+    common::nodeID_t nodeID;
+    graph::PersistentEdgeRange range;
+};
+
 struct FrontierTaskSharedState {
     FrontierPair& frontierPair;
 
-    explicit FrontierTaskSharedState(FrontierPair& frontierPair) : frontierPair{frontierPair} {}
+    // Adjacency lists with more than highDegreeThreshold persistent edges are split into edge
+    // range morsels of half that many edges, which are scanned by any of the task's threads.
+    // Otherwise, a single high-degree node can leave one thread running long after the others
+    // finish.
+    FrontierTaskSharedState(FrontierPair& frontierPair, uint64_t maxNumThreads,
+        uint64_t highDegreeThreshold)
+        : frontierPair{frontierPair}, enableEdgeRangeMorsels{maxNumThreads > 1},
+          highDegreeThreshold{highDegreeThreshold},
+          edgeRangeMorselSize{std::max<uint64_t>(highDegreeThreshold / 2, 1)},
+          numPendingEdgeRangeMorsels{0}, numThreadsScanningNodes{0} {}
     DELETE_COPY_AND_MOVE(FrontierTaskSharedState);
+
+    // Splits the adjacency list of nodeID into edge range morsels if it is a high-degree node.
+    // Returns false if the node should be scanned as a whole by the calling thread.
+    bool trySplitHighDegreeNode(common::nodeID_t nodeID, uint64_t numPersistentEdges);
+    bool hasPendingEdgeRangeMorsels() const {
+        return numPendingEdgeRangeMorsels.load(std::memory_order_relaxed) > 0;
+    }
+    bool getNextEdgeRangeMorsel(EdgeRangeMorsel& morsel);
+    // Threads that are still taking node morsels may still split high-degree nodes, so the other
+    // threads should not finish until all node morsels are done. Blocks until an edge range morsel
+    // is available, and returns false once all morsels are taken and no thread is taking node
+    // morsels.
+    bool waitForNextEdgeRangeMorsel(EdgeRangeMorsel& morsel);
+
+    void beginScanningNodes();
+    void finishScanningNodes();
+
+private:
+    void popEdgeRangeMorselNoLock(EdgeRangeMorsel& morsel);
+
+private:
+    bool enableEdgeRangeMorsels;
+    uint64_t highDegreeThreshold;
+    uint64_t edgeRangeMorselSize;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<EdgeRangeMorsel> edgeRangeMorsels;
+    std::atomic<uint64_t> numPendingEdgeRangeMorsels;
+    // Protected by mtx.
+    uint64_t numThreadsScanningNodes;
 };
 
 class FrontierTask : public common::Task {
@@ -37,6 +85,10 @@ public:
 
     void run() override;
 
+private:
+    graph::Graph::Iterator scan(common::nodeID_t nodeID, graph::GraphScanState& scanState,
+        const graph::PersistentEdgeRange& range) const;
+
 private:
     FrontierTaskInfo info;
     std::shared_ptr<FrontierTaskSharedState> sharedState;
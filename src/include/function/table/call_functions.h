@@ -127,6 +127,12 @@ struct ShowAttachedDatabasesFunction final : CallFunction {
     static function_set getFunctionSet();
 };
 
+struct StatementCacheInfoFunction final : CallFunction {
+    static constexpr const char* name = "STATEMENT_CACHE_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct ShowFunctionsFunction : public CallFunction {
     static constexpr const char* name = "SHOW_FUNCTIONS";
 
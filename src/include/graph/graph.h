@@ -26,6 +26,14 @@ struct RelTableIDInfo {
     common::table_id_t toNodeTableID;
 };
 
+// A range of rows [startRow, endRow) in the persistent adjacency list of a node. Scanning with a
+// range that does not start at 0 skips the node's in-memory and uncommitted edges, so that scanning
+// disjoint ranges that cover a list visits each edge exactly once.
+struct PersistentEdgeRange {
+    common::row_idx_t startRow = 0;
+    common::row_idx_t endRow = common::INVALID_ROW_IDX;
+};
+
 class GraphScanState {
 public:
     struct Chunk {
@@ -75,6 +83,11 @@ public:
     // Returns true if there are more values after the current batch
     virtual bool next() = 0;
 
+    // Returns the number of edges of the node being scanned that are stored in persistent adjacency
+    // lists, or 0 if unknown. This is cheap to compute after a scan has been initialized and is
+    // used to detect high-degree nodes whose adjacency lists should be split across threads.
+    virtual uint64_t getNumPersistentEdges() const { return 0; }
+
 protected:
     Chunk createChunk(std::span<const common::nodeID_t> nbrNodes,
         std::span<const common::relID_t> edges, common::SelectionVector& selVector,
@@ -174,7 +187,8 @@ public:
     // group will be scanned at once.
 
     // Get dst nodeIDs for given src nodeID using forward adjList.
-    virtual Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
+    virtual Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state,
+        const PersistentEdgeRange& range = PersistentEdgeRange{}) = 0;
 
     // We don't use scanBwd currently. I'm adding them because they are the mirroring to scanFwd.
     // Also, algorithm may only need adjList index in single direction so we should make double
@@ -185,7 +199,8 @@ public:
         std::span<common::table_id_t> nodeTableIDs) = 0;
 
     // Get dst nodeIDs for given src nodeID tables using backward adjList.
-    virtual Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
+    virtual Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state,
+        const PersistentEdgeRange& range = PersistentEdgeRange{}) = 0;
 };
 
 } // namespace graph
@@ -55,7 +55,10 @@ struct OnDiskGraphScanState {
         }
 
         bool next(evaluator::ExpressionEvaluator* predicate);
-        void initScan();
+        void initScan(const PersistentEdgeRange& range);
+        uint64_t getNumPersistentEdges() const {
+            return tableScanState->getNumPersistentRowsOfBoundNode();
+        }
 
     private:
         common::ValueVector& dstVector() const { return *tableScanState->outputVectors[0]; }
@@ -87,6 +90,8 @@ public:
     }
     bool next() override;
 
+    uint64_t getNumPersistentEdges() const override { return numPersistentEdges; }
+
     void startScan(common::RelDataDirection direction_) {
         this->direction = direction_;
         iteratorIndex = 0;
@@ -114,6 +119,7 @@ private:
     std::unique_ptr<common::ValueVector> propertyVector;
     size_t iteratorIndex;
     common::RelDataDirection direction;
+    uint64_t numPersistentEdges;
 
     std::unique_ptr<evaluator::ExpressionEvaluator> relPredicateEvaluator;
 
@@ -146,8 +152,10 @@ public:
     std::unique_ptr<GraphScanState> prepareMultiTableScanBwd(
         std::span<common::table_id_t> nodeTableIDs) override;
 
-    Graph::Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state) override;
-    Graph::Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    Graph::Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state,
+        const PersistentEdgeRange& range = PersistentEdgeRange{}) override;
+    Graph::Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state,
+        const PersistentEdgeRange& range = PersistentEdgeRange{}) override;
 
 private:
     main::ClientContext* context;
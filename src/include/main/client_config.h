@@ -14,6 +14,7 @@ struct ClientConfigDefault {
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr bool ENABLE_SEMI_MASK = true;
     static constexpr bool ENABLE_ZONE_MAP = true;
+    static constexpr bool ENABLE_CARDINALITY_FEEDBACK = true;
     static constexpr bool ENABLE_GDS = true;
     static constexpr bool ENABLE_PROGRESS_BAR = false;
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
@@ -21,6 +22,8 @@ struct ClientConfigDefault {
     static constexpr uint32_t RECURSIVE_PATTERN_FACTOR = 100;
     static constexpr bool DISABLE_MAP_KEY_CHECK = true;
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
+    static constexpr uint64_t GDS_HIGH_DEGREE_THRESHOLD = 64 * 1024;
+    static constexpr bool ENABLE_RESULT_STREAMING = false;
 };
 
 struct ClientConfig {
@@ -32,6 +35,8 @@ struct ClientConfig {
     bool enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
     // If using zone map in scan.
     bool enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
+    // If using cardinalities observed in previous executions in join order enumeration.
+    bool enableCardinalityFeedback = ClientConfigDefault::ENABLE_CARDINALITY_FEEDBACK;
     // If compiling recursive pattern as GDS.
     bool enableGDS = ClientConfigDefault::ENABLE_GDS;
     // Number of threads for execution.
@@ -51,6 +56,11 @@ struct ClientConfig {
     // maximum number of cached warnings
     uint64_t warningLimit = ClientConfigDefault::WARNING_LIMIT;
     bool disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
+    // Number of edges above which GDS algorithms split the adjacency list of a node across threads.
+    uint64_t gdsHighDegreeThreshold = ClientConfigDefault::GDS_HIGH_DEGREE_THRESHOLD;
+    // If read-only queries hand out their result while it is being computed instead of
+    // materializing it first.
+    bool enableResultStreaming = ClientConfigDefault::ENABLE_RESULT_STREAMING;
 };
 
 } // namespace main
@@ -40,6 +40,7 @@ struct DBConfig;
 class Database;
 class DatabaseManager;
 class AttachedKuzuDatabase;
+class ResultStream;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -169,7 +170,13 @@ private:
         const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams);
 
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
-        uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt);
+        uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt,
+        bool allowStreaming = false);
+
+    bool canStreamResult(PreparedStatement* preparedStatement) const;
+    // Streamed results hold the transaction context, so they are finished before running anything
+    // else on this client context.
+    void finishResultStreamNoLock();
 
     bool canExecuteWriteQuery();
 
@@ -197,6 +204,8 @@ private:
     std::unique_ptr<common::ProgressBar> progressBar;
     // Warning information
     processor::WarningContext warningContext;
+    // Result of the last query if it is streamed and may still be running.
+    std::shared_ptr<ResultStream> resultStream;
     std::mutex mtx;
 };
 
@@ -32,10 +32,15 @@ namespace storage {
 class StorageExtension;
 } // namespace storage
 
+namespace planner {
+class CardinalityFeedback;
+} // namespace planner
+
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
 class ClientContext;
+class StatementCache;
 
 /**
  * @brief Stores runtime configuration for creating or opening a Database
@@ -61,10 +66,13 @@ struct KUZU_API SystemConfig {
      * the WAL file exceeds the checkpoint threshold.
      * @param checkpointThreshold The threshold of the WAL file size in bytes. When the size of the
      * WAL file exceeds this threshold, the database will checkpoint if autoCheckpoint is true.
+     * @param scanResistantEviction If true, pages read by large scans are evicted before pages
+     * read by lookups, so that a scan does not flush the working set out of the buffer pool.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
         bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
-        bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */);
+        bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */,
+        bool scanResistantEviction = true);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
@@ -73,6 +81,7 @@ struct KUZU_API SystemConfig {
     uint64_t maxDBSize;
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
+    bool scanResistantEviction;
 };
 
 /**
@@ -126,6 +135,12 @@ public:
 
     uint64_t getNextQueryID();
 
+    StatementCache* getStatementCache() const { return statementCache.get(); }
+
+    planner::CardinalityFeedback* getCardinalityFeedback() const {
+        return cardinalityFeedback.get();
+    }
+
 private:
     using construct_bm_func_t =
         std::function<std::unique_ptr<storage::BufferManager>(const Database&)>;
@@ -158,6 +173,8 @@ private:
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
     std::unique_ptr<DatabaseManager> databaseManager;
+    std::unique_ptr<StatementCache> statementCache;
+    std::unique_ptr<planner::CardinalityFeedback> cardinalityFeedback;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
     QueryIDGenerator queryIDGenerator;
 };
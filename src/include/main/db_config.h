@@ -61,6 +61,7 @@ struct DBConfig {
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
+    bool scanResistantEviction;
     std::optional<std::string> spillToDiskTmpFile;
 
     explicit DBConfig(const SystemConfig& systemConfig);
@@ -11,6 +11,7 @@
 
 namespace kuzu {
 namespace main {
+class ResultStream;
 
 /**
  * @brief QueryResult stores the result of a query execution.
@@ -72,7 +73,7 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. Not available for streamed results.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -104,11 +105,12 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. Not available for streamed results.
      */
     KUZU_API void resetIterator();
 
     processor::FactorizedTable* getTable() { return factorizedTable.get(); }
+    processor::FlatTupleIterator* getIterator() { return iterator.get(); }
 
     /**
      * @brief Returns the arrow schema of the query result.
@@ -136,6 +138,8 @@ private:
     void setColumnHeader(std::vector<std::string> columnNames,
         std::vector<common::LogicalType> columnTypes);
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_);
+    void initResultStream(std::shared_ptr<ResultStream> resultStream_);
+    std::vector<common::Value*> initTuple();
     void validateQuerySucceed() const;
 
 private:
@@ -150,6 +154,8 @@ private:
     std::shared_ptr<processor::FactorizedTable> factorizedTable;
     std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    // Set instead of the table if the result is streamed while the query is executing.
+    std::shared_ptr<ResultStream> resultStream;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
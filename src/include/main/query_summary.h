@@ -19,6 +19,7 @@ struct PreparedSummary { // NOLINT(*-pro-type-member-init)
  */
 class QuerySummary {
     friend class ClientContext;
+    friend class ResultStream;
     friend class benchmark::Benchmark;
 
 public:
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
+#include "processor/result/result_chunk_queue.h"
+
+namespace kuzu {
+namespace common {
+class Profiler;
+} // namespace common
+
+namespace processor {
+class QueryProcessor;
+class PhysicalPlan;
+struct ExecutionContext;
+} // namespace processor
+
+namespace main {
+class ClientContext;
+class QuerySummary;
+
+// Executes a read-only query in the background and hands its result to the consumer in chunks
+// through a bounded queue, so the result is never materialized as a whole. The stream keeps the
+// query's transaction open until execution ends. Running another statement on the same client
+// context finishes the stream, after which reading from it throws.
+class ResultStream {
+    static constexpr uint64_t CHUNK_QUEUE_CAPACITY = 16;
+
+public:
+    ResultStream(ClientContext* clientContext, processor::QueryProcessor* queryProcessor,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan,
+        std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext,
+        QuerySummary* querySummary);
+    ~ResultStream();
+
+    void start(std::vector<common::Value*> values);
+
+    // Throws if execution failed or the stream was finished before all tuples were read.
+    bool hasNext();
+    // Reads the next tuple into the values passed to start().
+    void getNext();
+
+    // Stops execution if it is still running and waits for it to end.
+    void finish();
+
+private:
+    void execute();
+
+private:
+    ClientContext* clientContext;
+    processor::QueryProcessor* queryProcessor;
+    std::unique_ptr<processor::PhysicalPlan> physicalPlan;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    QuerySummary* querySummary;
+
+    std::shared_ptr<processor::ResultChunkQueue> queue;
+    std::thread executionThread;
+    std::mutex mtx;
+    std::atomic<bool> closed;
+    // Set by the execution thread before it finishes the queue.
+    std::string errMsg;
+
+    // Set by the consumer once it read the last tuple.
+    std::atomic<bool> exhausted;
+    std::vector<common::Value*> valuesToCollect;
+    std::unique_ptr<processor::FactorizedTable> chunk;
+    std::unique_ptr<processor::FlatTupleIterator> iterator;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -81,6 +81,30 @@ struct EnableSemiMaskSetting {
     }
 };
 
+struct EnableCardinalityFeedbackSetting {
+    static constexpr auto name = "enable_cardinality_feedback";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableCardinalityFeedback = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableCardinalityFeedback);
+    }
+};
+
+struct EnableResultStreamingSetting {
+    static constexpr auto name = "enable_result_streaming";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableResultStreaming = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableResultStreaming);
+    }
+};
+
 struct DisableMapKeyCheck {
     static constexpr auto name = "disable_map_key_check";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -184,6 +208,18 @@ struct EnableMVCCSetting {
     }
 };
 
+struct GDSHighDegreeThresholdSetting {
+    static constexpr auto name = "debug_gds_high_degree_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->gdsHighDegreeThreshold = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->gdsHighDegreeThreshold);
+    }
+};
+
 struct CheckpointThresholdSetting {
     static constexpr auto name = "checkpoint_threshold";
     static constexpr auto inputType = common::LogicalTypeID::INT64;
@@ -220,6 +256,15 @@ struct ForceCheckpointClosingDBSetting {
     }
 };
 
+struct ScanResistantEvictionSetting {
+    static constexpr auto name = "scan_resistant_eviction";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->scanResistantEviction);
+    }
+};
+
 struct SpillToDiskFileSetting {
     static constexpr auto name = "spill_to_disk_tmp_file";
     static constexpr auto inputType = common::LogicalTypeID::STRING;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "common/api.h"
+
+namespace kuzu {
+namespace parser {
+class Statement;
+} // namespace parser
+
+namespace main {
+
+// Database-wide LRU cache of parsed statements, keyed by query text with surrounding whitespace
+// removed. Parsed statements are not modified once created, so connections can share them.
+// Only statements whose parse tree does not depend on the catalog are cached, so DDL does not
+// need to invalidate entries. Binding and planning still run on every execution, as their
+// results depend on the catalog and statistics seen by the transaction.
+class KUZU_API StatementCache {
+public:
+    static constexpr uint64_t DEFAULT_CAPACITY = 1024;
+
+    explicit StatementCache(uint64_t capacity = DEFAULT_CAPACITY) : capacity{capacity} {}
+
+    // Returns nullptr if the query is not cached.
+    std::shared_ptr<parser::Statement> get(std::string_view query);
+    void put(std::string_view query, std::shared_ptr<parser::Statement> statement);
+    void clear();
+
+    uint64_t getNumEntries();
+    uint64_t getNumHits();
+    uint64_t getNumMisses();
+
+    static bool canCache(const parser::Statement& statement);
+
+private:
+    static std::string_view normalize(std::string_view query);
+
+private:
+    using entry_t = std::pair<std::string, std::shared_ptr<parser::Statement>>;
+
+    std::mutex mtx;
+    uint64_t capacity;
+    // Most recently used entries first.
+    std::list<entry_t> entries;
+    std::unordered_map<std::string_view, std::list<entry_t>::iterator> entryMap;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+};
+
+} // namespace main
+} // namespace kuzu
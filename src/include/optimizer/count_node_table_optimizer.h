@@ -0,0 +1,27 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer answers COUNT(*) over all nodes of some tables, e.g. MATCH (a:person) RETURN
+// COUNT(*), from node group version info instead of scanning. We search for pattern
+// AGGREGATE(COUNT(*)) -> (PROJECTION) -> SCAN_NODE_TABLE
+// where the aggregate has no key and the scan has no predicate, and rewrite it as
+// COUNT_NODE_TABLE.
+class CountNodeTableOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitAggregateReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+namespace optimizer {
+
+// This optimizer pre-aggregates the build side of a hash join whose output is aggregated without
+// referring to the build side, e.g. MATCH (a)-[]->(b)-[]->(c) RETURN a.name, COUNT(*). We search
+// for pattern
+// AGGREGATE -> PROJECTION -> HASH JOIN
+// and rewrite the build side as AGGREGATE(build keys; COUNT(*) AS cnt) so that each build key is
+// materialized once. COUNT(*) of the outer aggregate is rewritten as SUM(cnt). MIN, MAX and
+// DISTINCT aggregates do not depend on the number of duplicates and are kept.
+class EagerAggregationOptimizer : public LogicalOperatorVisitor {
+public:
+    explicit EagerAggregationOptimizer(main::ClientContext* context) : context{context} {}
+
+    void rewrite(planner::LogicalPlan* plan);
+
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitAggregateReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+
+    std::shared_ptr<binder::Expression> createCountStar(const binder::expression_vector& keys);
+
+private:
+    main::ClientContext* context;
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "common/api.h"
+
+namespace kuzu {
+namespace planner {
+
+// Database-wide record of the number of tuples observed at the build side of hash joins, keyed by
+// a signature of the subquery graph (nodes, rels and predicates) the build side evaluates. The
+// join order enumerator uses observed cardinalities in place of estimates when it plans the same
+// subquery graph again, so badly estimated join orders are corrected on the next execution.
+class KUZU_API CardinalityFeedback {
+public:
+    static constexpr uint64_t MAX_NUM_ENTRIES = 4096;
+
+    std::optional<uint64_t> getCardinality(const std::string& signature);
+    void setCardinality(const std::string& signature, uint64_t cardinality);
+    void clear();
+
+    uint64_t getNumEntries();
+
+private:
+    std::mutex mtx;
+    std::unordered_map<std::string, uint64_t> cardinalities;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -11,8 +11,8 @@ class JoinOrderEnumeratorContext {
 
 public:
     JoinOrderEnumeratorContext()
-        : currentLevel{0}, maxLevel{0}, subPlansTable{std::make_unique<SubPlansTable>()},
-          queryGraph{nullptr} {}
+        : currentLevel{0}, maxLevel{0}, useCardinalityFeedback{false},
+          subPlansTable{std::make_unique<SubPlansTable>()}, queryGraph{nullptr} {}
     DELETE_COPY_DEFAULT_MOVE(JoinOrderEnumeratorContext);
 
     void init(const binder::QueryGraph* queryGraph, const binder::expression_vector& predicates);
@@ -45,6 +45,9 @@ private:
 
     uint32_t currentLevel;
     uint32_t maxLevel;
+    // If the cardinalities of subquery graphs are independent of an outer query, so that the
+    // cardinalities observed when executing them can be used to plan them later.
+    bool useCardinalityFeedback;
 
     std::unique_ptr<SubPlansTable> subPlansTable;
     const binder::QueryGraph* queryGraph;
@@ -41,6 +41,11 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    // Signature of the subquery graph evaluated by the build side. Empty if the build side
+    // cardinality should not be recorded.
+    void setBuildSideSignature(std::string signature) { buildSideSignature = std::move(signature); }
+    std::string getBuildSideSignature() const { return buildSideSignature; }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
     // Flat probe side key group in either of the following two cases:
@@ -61,6 +66,7 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SIPInfo sipInfo;
+    std::string buildSideSignature;
 };
 
 } // namespace planner
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "binder/expression/expression.h"
+#include "planner/operator/logical_operator.h"
+
+namespace kuzu {
+namespace planner {
+
+// LogicalCountNodeTable computes COUNT(*) over all nodes of the given tables from node group
+// version info, without scanning any column.
+class LogicalCountNodeTable final : public LogicalOperator {
+    static constexpr LogicalOperatorType type_ = LogicalOperatorType::COUNT_NODE_TABLE;
+
+public:
+    LogicalCountNodeTable(std::vector<common::table_id_t> nodeTableIDs,
+        std::shared_ptr<binder::Expression> countExpr)
+        : LogicalOperator{type_}, nodeTableIDs{std::move(nodeTableIDs)},
+          countExpr{std::move(countExpr)} {}
+
+    void computeFactorizedSchema() override { computeSchema(); }
+    void computeFlatSchema() override { computeSchema(); }
+
+    std::string getExpressionsForPrinting() const override { return countExpr->toString(); }
+
+    std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
+    std::shared_ptr<binder::Expression> getCountExpr() const { return countExpr; }
+
+    std::unique_ptr<LogicalOperator> copy() override {
+        return std::make_unique<LogicalCountNodeTable>(nodeTableIDs, countExpr);
+    }
+
+private:
+    void computeSchema();
+
+private:
+    std::vector<common::table_id_t> nodeTableIDs;
+    std::shared_ptr<binder::Expression> countExpr;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -188,6 +188,9 @@ public:
     void planLevel(uint32_t level);
     void planLevelExactly(uint32_t level);
     void planLevelApproximately(uint32_t level);
+    // Replace estimated cardinalities of the plans in the level with observed ones, if any.
+    void applyCardinalityFeedback(uint32_t level);
+    std::string getSubqueryGraphSignature(const binder::SubqueryGraph& subgraph);
 
     // Plan worst case optimal join
     void planWCOJoin(uint32_t leftLevel, uint32_t rightLevel);
@@ -9,6 +9,11 @@ namespace kuzu {
 namespace planner {
 
 const uint64_t MAX_LEVEL_TO_PLAN_EXACTLY = 7;
+// Beyond MAX_LEVEL_TO_PLAN_EXACTLY, each level only extends the cheapest subgraphs of the previous
+// level. Once more than MAX_NUM_PLANS_TO_ENUMERATE plans have been enumerated for a query graph,
+// only the cheapest subgraph is extended, which degrades into greedy enumeration.
+const uint64_t MAX_NUM_SUBGRAPHS_TO_EXTEND = 8;
+const uint64_t MAX_NUM_PLANS_TO_ENUMERATE = 10000;
 
 // Different from vanilla dp algorithm where one optimal plan is kept per subgraph, we keep multiple
 // plans each with a different factorization structure. The following example will explain our
@@ -26,6 +31,7 @@ public:
     explicit SubgraphPlans(const binder::SubqueryGraph& subqueryGraph);
 
     inline uint64_t getMaxCost() const { return maxCost; }
+    uint64_t getMinCost() const;
 
     void addPlan(std::unique_ptr<LogicalPlan> plan);
 
@@ -63,8 +69,16 @@ public:
 
     void addPlan(const binder::SubqueryGraph& subqueryGraph, std::unique_ptr<LogicalPlan> plan);
 
+    // Keeps the subgraphs with the cheapest plans.
+    void prune(uint64_t maxNumSubgraphs);
+
     inline void clear() { subgraph2Plans.clear(); }
 
+private:
+    // Removes the subgraph whose cheapest plan is the most expensive, if that plan costs more than
+    // the given cost. Returns whether a subgraph was removed.
+    bool tryEvictSubgraph(uint64_t cost);
+
 private:
     constexpr static uint32_t MAX_NUM_SUBGRAPH = 50;
 
@@ -87,6 +101,11 @@ public:
 
     void addPlan(const binder::SubqueryGraph& subqueryGraph, std::unique_ptr<LogicalPlan> plan);
 
+    void pruneLevel(uint32_t level, uint64_t maxNumSubgraphs);
+
+    // Number of plans added since the table was last cleared, including plans that were not kept.
+    uint64_t getNumPlansEnumerated() const { return numPlansEnumerated; }
+
     void clear();
 
 private:
@@ -96,6 +115,7 @@ private:
 
 private:
     std::vector<std::unique_ptr<DPLevel>> dpLevels;
+    uint64_t numPlansEnumerated = 0;
 };
 
 } // namespace planner
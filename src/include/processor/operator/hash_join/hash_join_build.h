@@ -61,10 +61,13 @@ public:
           payloadsPos{std::move(payloadsPos)}, tableSchema{std::move(tableSchema)} {}
     HashJoinBuildInfo(const HashJoinBuildInfo& other)
         : keysPos{other.keysPos}, fStateTypes{other.fStateTypes}, payloadsPos{other.payloadsPos},
-          tableSchema{other.tableSchema.copy()} {}
+          tableSchema{other.tableSchema.copy()}, buildSideSignature{other.buildSideSignature} {}
 
     uint32_t getNumKeys() const { return keysPos.size(); }
 
+    // If set, the number of tuples built is recorded as the cardinality of the build side.
+    void setBuildSideSignature(std::string signature) { buildSideSignature = std::move(signature); }
+
     const FactorizedTableSchema* getTableSchema() const { return &tableSchema; }
 
     std::unique_ptr<HashJoinBuildInfo> copy() const {
@@ -76,6 +79,7 @@ private:
     std::vector<common::FStateType> fStateTypes;
     std::vector<DataPos> payloadsPos;
     FactorizedTableSchema tableSchema;
+    std::string buildSideSignature;
 };
 
 class HashJoinBuild : public Sink {
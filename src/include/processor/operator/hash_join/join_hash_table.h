@@ -43,6 +43,15 @@ public:
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
+    // Returns false if no build-side key has the given hash. May return true for hashes without a
+    // match.
+    bool mayContainHash(common::hash_t hash) const {
+        if (!bloomFilter) {
+            return true;
+        }
+        const auto mask = getBloomFilterMask(hash);
+        return (getBloomFilterWords()[hash >> bloomFilterWordIdxShift] & mask) == mask;
+    }
     uint8_t* getTupleForHash(common::hash_t hash) {
         auto slotIdx = getSlotIdxForHash(hash);
         KU_ASSERT(slotIdx < maxNumHashSlots);
@@ -62,11 +71,32 @@ private:
 
     common::offset_t getHashValueColOffset() const;
 
+    void allocateBloomFilter(uint64_t numTuples);
+    uint64_t* getBloomFilterWords() const {
+        return reinterpret_cast<uint64_t*>(bloomFilter->getData());
+    }
+    // Sets three bits of a 64-bit word, so that a lookup only reads a single word.
+    static uint64_t getBloomFilterMask(common::hash_t hash) {
+        return (uint64_t{1} << (hash & 63)) | (uint64_t{1} << ((hash >> 6) & 63)) |
+               (uint64_t{1} << ((hash >> 12) & 63));
+    }
+
 private:
     static constexpr uint64_t PREV_PTR_COL_IDX = 1;
     static constexpr uint64_t HASH_COL_IDX = 2;
+    // Below this size the hash slots are likely to be cached, and a bloom filter lookup costs about
+    // as much as a slot lookup.
+    static constexpr uint64_t MIN_NUM_TUPLES_FOR_BLOOM_FILTER = 1 << 15;
+    static constexpr uint64_t BLOOM_FILTER_NUM_BITS_PER_TUPLE = 16;
     const FactorizedTableSchema* tableSchema;
     uint64_t prevPtrColOffset;
+    // Bloom filter over the hashes of the build-side keys, which is checked before reading the hash
+    // slots when probing. Probe keys without a match then skip the slot and chain accesses, which
+    // are cache misses once the hash table is large. The word of a hash is selected by its high
+    // bits, which are independent of the low bits used for the hash slot and the mask. Like the
+    // hash slots, it is allocated through the memory manager.
+    std::unique_ptr<storage::MemoryBuffer> bloomFilter;
+    uint64_t bloomFilterWordIdxShift = 0;
 };
 
 } // namespace processor
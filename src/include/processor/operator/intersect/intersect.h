@@ -28,6 +28,9 @@ private:
 
 class Intersect : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::INTERSECT;
+    // Lists whose sizes differ by more than this factor are intersected by searching for each value
+    // of the shorter list in the longer one instead of merging them.
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
 
 public:
     Intersect(const DataPos& outputDataPos, std::vector<IntersectDataInfo> intersectDataInfos,
@@ -3,6 +3,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_chunk_queue.h"
 
 namespace kuzu {
 namespace processor {
@@ -19,9 +20,15 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // When set, collected tuples are pushed to the queue in chunks instead of being merged into
+    // the shared table.
+    void setChunkQueue(std::shared_ptr<ResultChunkQueue> queue) { chunkQueue = std::move(queue); }
+    ResultChunkQueue* getChunkQueue() const { return chunkQueue.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<ResultChunkQueue> chunkQueue;
 };
 
 struct ResultCollectorInfo {
@@ -61,6 +68,8 @@ struct ResultCollectorPrintInfo final : OPPrintInfo {
 
 class ResultCollector : public Sink {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RESULT_COLLECTOR;
+    // Number of tuples a streaming result collector buffers before pushing them as one chunk.
+    static constexpr uint64_t STREAMING_CHUNK_SIZE = common::DEFAULT_VECTOR_CAPACITY;
 
 public:
     ResultCollector(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
@@ -76,6 +85,12 @@ public:
 
     std::shared_ptr<FactorizedTable> getResultFactorizedTable() { return sharedState->getTable(); }
 
+    // Streams the collected tuples through the queue. Only valid for the root result collector.
+    void setChunkQueue(std::shared_ptr<ResultChunkQueue> queue) {
+        KU_ASSERT(info.accumulateType == common::AccumulateType::REGULAR);
+        sharedState->setChunkQueue(std::move(queue));
+    }
+
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info.copy(), sharedState,
             children[0]->clone(), id, printInfo->copy());
@@ -84,6 +99,8 @@ public:
 private:
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
+    void pushLocalTable(ResultChunkQueue& queue, ExecutionContext* context);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
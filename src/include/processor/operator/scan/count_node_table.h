@@ -0,0 +1,53 @@
+#pragma once
+
+#include "processor/operator/physical_operator.h"
+#include "storage/store/node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct CountNodeTablePrintInfo final : OPPrintInfo {
+    std::vector<std::string> tableNames;
+
+    explicit CountNodeTablePrintInfo(std::vector<std::string> tableNames)
+        : tableNames{std::move(tableNames)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::make_unique<CountNodeTablePrintInfo>(tableNames);
+    }
+};
+
+// CountNodeTable outputs the number of nodes visible to the transaction in the given tables. Node
+// groups are counted from their version info, so only vectors with uncommitted or deleted rows
+// are checked row by row and no column is read.
+class CountNodeTable final : public PhysicalOperator {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::COUNT_NODE_TABLE;
+
+public:
+    CountNodeTable(std::vector<storage::NodeTable*> tables, DataPos outputPos, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : PhysicalOperator{type_, id, std::move(printInfo)}, tables{std::move(tables)},
+          outputPos{outputPos}, outputVector{nullptr}, executed{false} {}
+
+    bool isSource() const override { return true; }
+    bool isParallel() const override { return false; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<CountNodeTable>(tables, outputPos, id, printInfo->copy());
+    }
+
+private:
+    std::vector<storage::NodeTable*> tables;
+    DataPos outputPos;
+    common::ValueVector* outputVector;
+    bool executed;
+};
+
+} // namespace processor
+} // namespace kuzu
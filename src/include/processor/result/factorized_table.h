@@ -242,6 +242,15 @@ public:
 
     void resetState();
 
+    // The following functions are only valid for tables without unflat columns, in which each
+    // tuple is a single flat tuple. They let callers read tuples from the table directly.
+    // Returns the index of the next tuple to be read.
+    ft_tuple_idx_t getNextTupleIdx() const {
+        return nextFlatTupleIdx < numFlatTuples ? nextTupleIdx - 1 : nextTupleIdx;
+    }
+    // Moves the iterator past the given number of tuples without reading them.
+    void skipTuples(uint64_t numTuplesToSkip);
+
 private:
     // The dataChunkPos may be not consecutive, which means some entries in the
     // flatTuplePositionsInDataChunk is invalid. We put pair(UINT64_MAX, UINT64_MAX) in the
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Hands the result of a streamed query from its result collectors to the consumer in chunks. The
+// queue holds at most `capacity` chunks and producers block while it is full, so execution never
+// runs more than `capacity` chunks ahead of the consumer.
+class ResultChunkQueue {
+public:
+    explicit ResultChunkQueue(uint64_t capacity)
+        : capacity{capacity}, finished{false}, closed{false} {}
+
+    // Blocks while the queue is full. Returns false if the consumer closed the queue, in which case
+    // the chunk is dropped and the producer should stop.
+    bool push(std::unique_ptr<FactorizedTable> chunk);
+    // Blocks until a chunk is available. Returns nullptr once producing finished and all chunks have
+    // been taken.
+    std::unique_ptr<FactorizedTable> pop();
+    // Marks that no more chunks will be pushed.
+    void finish();
+    // Drops all queued chunks and wakes up blocked producers.
+    void close();
+
+private:
+    uint64_t capacity;
+    std::mutex mtx;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<std::unique_ptr<FactorizedTable>> chunks;
+    bool finished;
+    bool closed;
+};
+
+} // namespace processor
+} // namespace kuzu
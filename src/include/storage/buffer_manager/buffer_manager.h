@@ -162,7 +162,9 @@ private:
  * reads on it;
  * 3. The MARKED page can be optimistically read by the caller, setting the page's state to
  * UNLOCKED. For evicted pages, optimistic reads will trigger pin and unpin to read pages from disk
- * into frames.
+ * into frames. With scan resistant eviction enabled, reads with the SCAN access hint read MARKED
+ * pages without unmarking them, so pages only touched by scans are evicted on the first pass of
+ * the eviction queue while pages with other readers get a second chance.
  * 4. The MARKED page can be pinned again by the caller, setting the page's state to LOCKED.
  * 5. The UNLOCKED page can also be pinned again by the caller, setting the page's state to LOCKED.
  * 6. During eviction, UNLOCKED pages will be check if they are second chance evictable. If so, they
@@ -181,8 +183,12 @@ class BufferManager {
     friend class MemoryManager;
 
 public:
+    // Upper bound on the number of pages read together by `optimisticReadPages`.
+    static constexpr common::page_idx_t MAX_NUM_PAGES_PER_EXTENT_READ = 64;
+
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly);
+        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly,
+        bool scanResistantEviction = true);
     virtual ~BufferManager();
 
     // Currently, these functions are specifically used only for WAL files.
@@ -209,6 +215,8 @@ public:
 
     void resetSpiller(const main::DBConfig& dbConfig);
 
+    void setScanResistantEviction(bool enable) { scanResistantEviction = enable; }
+
 protected:
     // Reclaims used memory until the given size to reserve is available
     // The specified amount of memory will be recorded as being used
@@ -218,7 +226,16 @@ private:
     uint8_t* pin(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(FileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT);
+    // Optimistically reads a run of pages within one page group, whose frames are contiguous, with
+    // a single call to func. Returns false without retrying if any of the pages is not cached or is
+    // changed during the read, in which case the caller should fall back to `optimisticRead`.
+    bool optimisticReadPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages, const std::function<void(uint8_t*)>& func,
+        PageAccessHint accessHint);
+    void prefetchPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
     // The function assumes that the requested page is already pinned.
     void unpin(FileHandle& fileHandle, common::page_idx_t pageIdx);
     uint8_t* getFrame(FileHandle& fileHandle, common::page_idx_t pageIdx) const {
@@ -238,6 +255,11 @@ private:
 
     void cachePageIntoFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    // Reads the given pages, which must be locked and EVICTED and must belong to the same page
+    // group, into their frames with a single read. Returns false, leaving the pages EVICTED, if
+    // there is not enough free memory to hold them without evicting other pages.
+    bool cachePagesIntoFrames(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
     void removePageFromFrame(FileHandle& fileHandle, common::page_idx_t pageIdx, bool shouldFlush);
 
     uint64_t freeUsedMemory(uint64_t size);
@@ -261,6 +283,9 @@ private:
     std::vector<std::unique_ptr<FileHandle>> fileHandles;
     std::unique_ptr<Spiller> spiller;
     common::VirtualFileSystem* vfs;
+    // If set, pages loaded by SCAN reads or prefetching enter the eviction queue MARKED, and SCAN
+    // reads leave MARKED pages MARKED. See `optimisticRead`.
+    std::atomic<bool> scanResistantEviction;
 };
 
 } // namespace storage
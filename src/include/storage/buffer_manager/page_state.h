@@ -49,6 +49,11 @@ public:
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
         stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), UNLOCKED));
     }
+    // Like `unlock`, but leaves the page MARKED so that it is the first to be evicted unless it is
+    // read again before the eviction cursor reaches it.
+    void unlockAndMark() {
+        stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), MARKED));
+    }
     // Change page state from Mark to Unlocked.
     bool tryClearMark(uint64_t oldStateAndVersion) {
         KU_ASSERT(getState(oldStateAndVersion) == MARKED);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -110,6 +111,9 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    // Only used for the string data of dictionary chunks. Each string is encoded separately with
+    // a per-chunk symbol table; the encoded bytes are stored in pages like uncompressed data.
+    FSST = 5,
 };
 
 struct ExtraMetadata {
@@ -133,6 +137,27 @@ struct ALPMetadata : ExtraMetadata {
     std::unique_ptr<ExtraMetadata> copy() override;
 };
 
+// Symbol table of a string data chunk compressed with FSST.
+// Each code below ESCAPE_CODE stands for a symbol of up to MAX_SYMBOL_LENGTH bytes; ESCAPE_CODE is
+// followed by a single literal byte.
+struct FSSTMetadata : ExtraMetadata {
+    static constexpr uint8_t MAX_SYMBOL_LENGTH = 8;
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr uint16_t MAX_NUM_SYMBOLS = ESCAPE_CODE;
+
+    FSSTMetadata() : numSymbols{0}, symbols{}, symbolLengths{} {}
+
+    uint16_t numSymbols;
+    // Symbol bytes are stored in the low-order bytes of each value.
+    std::array<uint64_t, MAX_NUM_SYMBOLS> symbols;
+    std::array<uint8_t, MAX_NUM_SYMBOLS> symbolLengths;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
 struct InPlaceUpdateLocalState {
     struct FloatState {
         size_t newExceptionCount;
@@ -185,6 +210,9 @@ struct CompressionMetadata {
     inline ALPMetadata* floatMetadata() {
         return common::ku_dynamic_cast<ALPMetadata*>(getExtraMetadata());
     }
+    inline const FSSTMetadata* fsstMetadata() const {
+        return common::ku_dynamic_cast<const FSSTMetadata*>(getExtraMetadata());
+    }
 
     void serialize(common::Serializer& serializer) const;
     static CompressionMetadata deserialize(common::Deserializer& deserializer);
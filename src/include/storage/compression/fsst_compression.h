@@ -0,0 +1,56 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+// Lightweight string compression based on FSST (Fast Static Symbol Table), which replaces
+// frequent substrings of up to 8 bytes with single byte codes. Strings are encoded independently
+// of each other, so any string can be decoded on its own given the symbol table.
+class FSSTCompression {
+public:
+    // A string that contains no symbol needs two bytes for each of its bytes.
+    static constexpr uint64_t MAX_COMPRESSION_OVERHEAD_FACTOR = 2;
+
+    // Builds a symbol table from a sample of the strings to be compressed.
+    static FSSTMetadata buildSymbolTable(std::span<const std::string_view> sample);
+
+    static uint64_t getMaxCompressedSize(uint64_t size) {
+        return size * MAX_COMPRESSION_OVERHEAD_FACTOR;
+    }
+
+    // Appends the decoded bytes to the result.
+    static void decompress(const FSSTMetadata& metadata, const uint8_t* data, uint64_t size,
+        std::string& result);
+};
+
+// Encodes strings with a symbol table. Construction builds a lookup structure for the table, so
+// an encoder should be reused for all strings compressed with the same table.
+class FSSTEncoder {
+    friend class FSSTCompression;
+
+public:
+    explicit FSSTEncoder(const FSSTMetadata& metadata);
+
+    // Appends the encoded bytes to the result.
+    void compress(std::string_view str, std::vector<uint8_t>& result) const;
+    uint64_t getCompressedSize(std::string_view str) const;
+
+private:
+    // Returns the code of the longest symbol that is a prefix of str, or ESCAPE_CODE.
+    uint8_t findLongestSymbol(const uint8_t* str, uint64_t size) const;
+
+private:
+    const FSSTMetadata& metadata;
+    // Codes of the symbols starting with each byte, longest symbols first.
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+} // namespace storage
+} // namespace kuzu
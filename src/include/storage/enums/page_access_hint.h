@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// SCAN marks reads that are part of a large sequential scan. Such reads do not count as a
+// reference to the page for eviction, so that a scan does not push frequently used pages out of
+// the buffer pool.
+enum class PageAccessHint : uint8_t { DEFAULT = 0, SCAN = 1 };
+
+} // namespace storage
+} // namespace kuzu
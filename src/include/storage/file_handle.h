@@ -15,6 +15,7 @@
 #include "common/types/types.h"
 #include "storage/buffer_manager/page_state.h"
 #include "storage/buffer_manager/vm_region.h"
+#include "storage/enums/page_access_hint.h"
 #include "storage/enums/page_read_policy.h"
 
 namespace kuzu {
@@ -63,7 +64,16 @@ public:
 
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT);
+    // Reads the given pages, which must belong to the same page group, with a single call to
+    // readOp on the frame of the first page. Returns false if the pages are not all cached.
+    bool optimisticReadPages(common::page_idx_t startPageIdx, common::page_idx_t numPagesToRead,
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT);
+    // Best-effort read-ahead of the pages in [startPageIdx, startPageIdx + numPages) that are not
+    // cached. Adjacent pages are read from the file together.
+    void prefetchPages(common::page_idx_t startPageIdx, common::page_idx_t numPages);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
 
@@ -84,9 +94,14 @@ public:
     void flushAllDirtyPagesInFrames();
 
     void readPageFromDisk(uint8_t* frame, common::page_idx_t pageIdx) const {
+        readPagesFromDisk(frame, pageIdx, 1 /* numPagesToRead */);
+    }
+    void readPagesFromDisk(uint8_t* frame, common::page_idx_t startPageIdx,
+        common::page_idx_t numPagesToRead) const {
         KU_ASSERT(!isInMemoryMode());
-        KU_ASSERT(pageIdx < numPages);
-        fileInfo->readFromFile(frame, getPageSize(), pageIdx * getPageSize());
+        KU_ASSERT(startPageIdx + numPagesToRead <= numPages);
+        fileInfo->readFromFile(frame, numPagesToRead * getPageSize(),
+            startPageIdx * getPageSize());
     }
     void writePageToFile(const uint8_t* buffer, common::page_idx_t pageIdx) {
         KU_ASSERT(pageIdx < numPages);
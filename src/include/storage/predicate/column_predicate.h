@@ -4,6 +4,11 @@
 #include "common/cast.h"
 #include "common/enums/zone_map_check_result.h"
 
+namespace kuzu::common {
+class SelectionVector;
+class ValueVector;
+} // namespace kuzu::common
+
 namespace kuzu {
 namespace storage {
 
@@ -21,6 +26,8 @@ public:
     bool isEmpty() const { return predicates.empty(); }
 
     common::ZoneMapCheckResult checkZoneMap(const ColumnChunkStats& stats) const;
+    // Removes from selVector the positions of the scanned vector that fail any of the predicates.
+    void select(const common::ValueVector& vector, common::SelectionVector& selVector) const;
 
     std::string toString() const;
 
@@ -40,6 +47,12 @@ public:
 
     virtual common::ZoneMapCheckResult checkZoneMap(const ColumnChunkStats& stats) const = 0;
 
+    // Evaluates the predicate on the selected positions of a scanned vector and keeps only the
+    // positions that satisfy it. Predicates that cannot be evaluated on the vector leave selVector
+    // unchanged; rows are filtered again by the operators above the scan.
+    virtual void select(const common::ValueVector& /*vector*/,
+        common::SelectionVector& /*selVector*/) const {}
+
     virtual std::string toString() = 0;
 
     virtual std::unique_ptr<ColumnPredicate> copy() const = 0;
@@ -16,6 +16,9 @@ public:
 
     common::ZoneMapCheckResult checkZoneMap(const ColumnChunkStats& stats) const override;
 
+    void select(const common::ValueVector& vector,
+        common::SelectionVector& selVector) const override;
+
     std::string toString() override;
 
     std::unique_ptr<ColumnPredicate> copy() const override {
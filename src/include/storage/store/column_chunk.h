@@ -87,6 +87,8 @@ public:
 
     ResidencyState getResidencyState() const { return data->getResidencyState(); }
     bool hasUpdates() const { return updateInfo != nullptr; }
+    bool isUpdatedByConcurrentTransaction(const transaction::Transaction* transaction,
+        common::row_idx_t rowInChunk) const;
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
     // These functions should only work on in-memory and temporary column chunks.
@@ -44,6 +44,10 @@ struct ColumnReadWriterFactory {
 
 class ColumnReadWriter {
 public:
+    // When a scan reaches a page that is not cached, the pages of the column chunk up to this many
+    // pages ahead are read in as well, so that sequential scans issue large reads.
+    static constexpr common::page_idx_t READ_AHEAD_NUM_PAGES = 64;
+
     ColumnReadWriter(DBFileID dbFileID, FileHandle* dataFH, BufferManager* bufferManager,
         ShadowFile* shadowFile);
 
@@ -79,7 +83,14 @@ public:
         common::offset_t numValues, const write_values_func_t& writeFunc) = 0;
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readFunc);
+        const std::function<void(uint8_t*)>& readFunc,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT);
+
+    // Reads a run of pages of the data file as one extent. Returns false, without calling readFunc,
+    // if the pages cannot be read together, e.g. because some of them are not cached.
+    bool readFromPages(transaction::Transaction* transaction, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages, const std::function<void(uint8_t*)>& readFunc,
+        PageAccessHint accessHint);
 
     void updatePageWithCursor(PageCursor cursor,
         const std::function<void(uint8_t*, common::offset_t)>& writeOp) const;
@@ -88,6 +99,10 @@ public:
         common::page_idx_t groupPageIdx, uint64_t numValuesPerPage) const;
 
 protected:
+    static PageAccessHint getAccessHintForRangeRead(const ColumnChunkMetadata& metadata);
+    void readAheadIfNotCached(transaction::Transaction* transaction,
+        const ColumnChunkMetadata& metadata, common::page_idx_t pageIdx);
+
     std::pair<common::offset_t, PageCursor> getOffsetAndCursor(common::offset_t nodeOffset,
         const ChunkState& state) const;
 
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <bitset>
+#include <unordered_map>
 
 #include "common/data_chunk/data_chunk.h"
 #include "storage/store/csr_chunked_node_group.h"
@@ -28,77 +29,100 @@ enum class CSRNodeGroupScanSource : uint8_t {
     NONE = 10
 };
 
-// Store rows of a CSR list.
-// If rows of the CSR list are stored in a sequential order, then `isSequential` is set to true.
-// rowIndices consists of startRowIdx and length.
-// Otherwise, rowIndices records the row indices of each row in the CSR list.
+// Rows of a single CSR list.
+// If rows of the CSR list are stored in a sequential order, then `isSequential` is set to true and
+// `sequentialRows` holds the start row and the number of rows. Otherwise, `rowIndices` records the
+// row indices of each row in the CSR list.
 struct NodeCSRIndex {
-    // TODO(Guodong): Should seperate `isSequential` and `rowIndices` to two different data
-    // structures. so the struct can be more space efficient.
     bool isSequential = false;
-    row_idx_vec_t rowIndices; // TODO(Guodong): Should optimze the vector to a more space-efficient
-                              // data structure.
+    csr_list_t sequentialRows;
+    row_idx_vec_t rowIndices;
 
     bool isEmpty() const { return getNumRows() == 0; }
     common::row_idx_t getNumRows() const {
-        if (isSequential) {
-            return rowIndices[1];
-        }
-        return rowIndices.size();
+        return isSequential ? sequentialRows.length : rowIndices.size();
     }
-    row_idx_vec_t getRows() const {
-        if (isSequential) {
-            row_idx_vec_t result;
-            result.reserve(rowIndices[1]);
-            for (common::row_idx_t i = 0u; i < rowIndices[1]; ++i) {
-                result.push_back(i + rowIndices[0]);
-            }
-            return result;
-        }
-        return rowIndices;
+    common::row_idx_t getRow(common::idx_t idx) const {
+        KU_ASSERT(idx < getNumRows());
+        return isSequential ? sequentialRows.startRow + idx : rowIndices[idx];
     }
 
     void clear() {
         isSequential = false;
+        sequentialRows = csr_list_t{};
         rowIndices.clear();
     }
-
-    void turnToNonSequential() {
-        if (isSequential) {
-            row_idx_vec_t newIndices;
-            newIndices.reserve(rowIndices[1]);
-            for (common::row_idx_t i = 0u; i < rowIndices[1]; ++i) {
-                newIndices.push_back(i + rowIndices[0]);
-            }
-            rowIndices = std::move(newIndices);
-            isSequential = false;
-        }
-    }
-    void setInvalid(common::idx_t idx) {
-        KU_ASSERT(!isSequential);
-        KU_ASSERT(idx < rowIndices.size());
-        rowIndices[idx] = common::INVALID_ROW_IDX;
-    }
 };
 
-// TODO(Guodong): Split CSRIndex into two levels: one level per csr leaf region, another per node
-// under the leaf region. This should be more space efficient.
-struct CSRIndex {
-    std::array<NodeCSRIndex, common::StorageConstants::NODE_GROUP_SIZE> indices;
+// Index from bound node offsets to the rows of their in-memory CSR lists.
+// The index is split into one region per csr leaf region, which is only allocated once a rel is
+// inserted into one of its nodes. Within a region, each node keeps its rows as a single
+// (startRow, length) run as long as they are sequential, which avoids a heap allocation per node
+// for bulk appends. Only nodes whose rows are not sequential keep their row indices in a vector.
+class CSRIndex {
+    static constexpr uint64_t NUM_REGIONS = common::StorageConstants::NODE_GROUP_SIZE /
+                                            common::StorageConstants::CSR_LEAF_REGION_SIZE;
+
+    struct Region {
+        // A list with startRow set to INVALID_ROW_IDX and a non-zero length is non-sequential.
+        std::array<csr_list_t, common::StorageConstants::CSR_LEAF_REGION_SIZE> lists;
+        std::unordered_map<common::offset_t, row_idx_vec_t> nonSequentialRows;
+    };
+
+public:
+    void appendRows(common::offset_t offset, common::row_idx_t startRow, common::length_t length);
+    // Marks the idx-th row of the csr list as invalid (e.g., deleted). This turns the list
+    // non-sequential.
+    void setInvalid(common::offset_t offset, common::idx_t idx);
 
     common::row_idx_t getNumRows(common::offset_t offset) const {
-        return indices[offset].getNumRows();
+        const auto region = getRegion(offset);
+        return region ? region->lists[getOffsetInRegion(offset)].length : 0;
+    }
+    bool isSequential(common::offset_t offset) const {
+        const auto region = getRegion(offset);
+        return region &&
+               region->lists[getOffsetInRegion(offset)].startRow != common::INVALID_ROW_IDX;
     }
+    common::offset_t getMaxOffsetWithRels() const;
 
-    common::offset_t getMaxOffsetWithRels() const {
-        common::offset_t maxOffset = 0;
-        for (auto i = 0u; i < indices.size(); i++) {
-            if (!indices[i].isEmpty()) {
-                maxOffset = i;
+    NodeCSRIndex getNodeCSRIndex(common::offset_t offset) const;
+
+    // Calls func(idx, row) for each row of the csr list without materializing the rows.
+    template<typename Func>
+    void forEachRow(common::offset_t offset, Func func) const {
+        const auto region = getRegion(offset);
+        if (!region) {
+            return;
+        }
+        const auto offsetInRegion = getOffsetInRegion(offset);
+        const auto& list = region->lists[offsetInRegion];
+        if (list.startRow != common::INVALID_ROW_IDX) {
+            for (auto i = 0u; i < list.length; i++) {
+                func(i, list.startRow + i);
+            }
+        } else if (list.length > 0) {
+            const auto& rows = region->nonSequentialRows.at(offsetInRegion);
+            for (auto i = 0u; i < rows.size(); i++) {
+                func(i, rows[i]);
             }
         }
-        return maxOffset;
     }
+
+private:
+    static common::idx_t getRegionIdx(common::offset_t offset) {
+        return offset >> common::StorageConstants::CSR_LEAF_REGION_SIZE_LOG2;
+    }
+    static common::offset_t getOffsetInRegion(common::offset_t offset) {
+        return offset & (common::StorageConstants::CSR_LEAF_REGION_SIZE - 1);
+    }
+    const Region* getRegion(common::offset_t offset) const {
+        KU_ASSERT(getRegionIdx(offset) < NUM_REGIONS);
+        return regions[getRegionIdx(offset)].get();
+    }
+
+private:
+    std::array<std::unique_ptr<Region>, NUM_REGIONS> regions;
 };
 
 // TODO(Guodong): Serialize the info to disk. This should be a config per node group.
@@ -238,9 +262,6 @@ private:
     void initScanForCommittedInMem(RelTableScanState& relScanState,
         CSRNodeGroupScanState& nodeGroupScanState) const;
 
-    void updateCSRIndex(common::offset_t boundNodeOffsetInGroup, common::row_idx_t startRow,
-        common::length_t length) const;
-
     NodeGroupScanResult scanCommittedPersistent(const transaction::Transaction* transaction,
         RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const;
     NodeGroupScanResult scanCommittedPersistentWithCache(
@@ -262,6 +283,10 @@ private:
 
     void populateCSRLengthInMemOnly(const common::UniqLock& lock, common::offset_t numNodes,
         const CSRNodeGroupCheckpointState& csrState);
+    // Invalidates the in-memory rows of the csr list that have been deleted and returns the number
+    // of such rows.
+    common::row_idx_t invalidateDeletedRows(const common::UniqLock& lock,
+        common::offset_t nodeOffset) const;
 
     void collectRegionChangesAndUpdateHeaderLength(const common::UniqLock& lock, CSRRegion& region,
         const CSRNodeGroupCheckpointState& csrState);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storage/compression/compression.h"
 #include "storage/enums/residency_state.h"
 #include "storage/store/column_chunk_data.h"
 
@@ -12,6 +13,13 @@ public:
     using string_offset_t = uint64_t;
     using string_index_t = uint32_t;
 
+    // String data and offsets of the dictionary with the strings encoded using FSST.
+    struct CompressedStringData {
+        std::unique_ptr<ColumnChunkData> stringDataChunk;
+        std::unique_ptr<ColumnChunkData> offsetChunk;
+        FSSTMetadata metadata;
+    };
+
     DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enableCompression,
         ResidencyState residencyState);
     // A pointer to the dictionary chunk is stored in the StringOps for the indexTable
@@ -50,6 +58,15 @@ public:
 
     void flush(FileHandle& dataFH);
 
+    // Encodes the string data with a symbol table built from a sample of the strings. Returns
+    // std::nullopt if compression is disabled or the sample shows it would not pay off.
+    std::optional<CompressedStringData> compressStringData() const;
+    // Decodes string data that was scanned from an FSST compressed chunk on disk, replacing the
+    // encoded data and its offsets.
+    void decompressStringData(const FSSTMetadata& metadata);
+    // Marks a flushed string data chunk as FSST compressed with the given symbol table.
+    static void setFSSTMetadata(ColumnChunkData& stringDataChunk, const FSSTMetadata& metadata);
+
 private:
     bool enableCompression;
     // String data is stored as a UINT8 chunk, using the numValues in the chunk to track the number
@@ -147,6 +147,8 @@ public:
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInGroup);
 
     bool hasDeletions(const transaction::Transaction* transaction);
+    // Number of rows visible to the transaction, computed from version info without scanning.
+    common::row_idx_t getNumVisibleRows(const transaction::Transaction* transaction);
     virtual void addColumn(transaction::Transaction* transaction,
         TableAddColumnState& addColumnState, FileHandle* dataFH);
 
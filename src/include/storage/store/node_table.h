@@ -97,6 +97,9 @@ public:
         common::VirtualFileSystem* vfs, main::ClientContext* context);
 
     common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) override;
+    // Unlike getNumTotalRows, excludes rows that are deleted or not yet inserted to the
+    // transaction. Computed from the version info of each node group without scanning columns.
+    common::row_idx_t getNumVisibleRows(const transaction::Transaction* transaction) const;
 
     void initScanState(transaction::Transaction* transaction,
         TableScanState& scanState) const override;
@@ -24,6 +24,14 @@ struct RelTableScanState : TableScanState {
     // This is a reference of the original selVector of the input boundNodeIDVector.
     common::SelectionVector cachedBoundNodeSelVector;
 
+    // Restricts the scan of the csr list of a single bound node to rows
+    // [persistentStartRow, persistentEndRow) of its committed persistent data. This is used to
+    // split the adjacency list of a high-degree node across threads. In-memory and uncommitted rows
+    // of the csr list are only scanned if the range starts at 0, so that a list split into disjoint
+    // ranges is scanned exactly once.
+    common::row_idx_t persistentStartRow;
+    common::row_idx_t persistentEndRow;
+
     std::unique_ptr<LocalRelTableScanState> localTableScanState;
 
     // Scan state for un-committed data.
@@ -31,6 +39,7 @@ struct RelTableScanState : TableScanState {
         : TableScanState{tableID, columnIDs, {}, {}},
           direction{common::RelDataDirection::FWD /* This is a dummy placeholder */},
           currBoundNodeIdx{0}, csrOffsetColumn{nullptr}, csrLengthColumn{nullptr},
+          persistentStartRow{0}, persistentEndRow{common::INVALID_ROW_IDX},
           localTableScanState{nullptr} {
         nodeGroupScanState = std::make_unique<NodeGroupScanState>(columnIDs.size());
     }
@@ -57,6 +66,15 @@ struct RelTableScanState : TableScanState {
 
     void setNodeIDVectorToFlat(common::sel_t selPos) const;
 
+    void setPersistentRowRange(common::row_idx_t startRow, common::row_idx_t endRow) {
+        persistentStartRow = startRow;
+        persistentEndRow = endRow;
+    }
+    bool scanNonPersistentRows() const { return persistentStartRow == 0; }
+    // Returns the length of the committed persistent csr list of the bound node. Only valid after
+    // the scan state has been initialized for a single bound node.
+    common::row_idx_t getNumPersistentRowsOfBoundNode() const;
+
 private:
     bool hasUnComittedData() const;
 
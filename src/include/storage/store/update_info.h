@@ -1,6 +1,7 @@
 #pragma once
 
-#include <array>
+#include <functional>
+#include <vector>
 
 #include "column_chunk_data.h"
 #include "common/constants.h"
@@ -19,10 +20,22 @@ namespace storage {
 class MemoryManager;
 
 class ColumnChunkData;
+// Updates of a vector are stored sparsely: the i-th value in `data` is the new value of row
+// `rowsInVector[i]`. Both start small and grow with the number of updated rows, so that updating
+// a few rows of a vector does not allocate space for all of its rows.
+// A version created while no other transaction has pending updates in the vector copies all
+// older updates, so readers can stop at it. A version created next to concurrent writers only
+// holds the updates of its own transaction (a delta), and readers merge it with older versions.
 struct VectorUpdateInfo {
+    static constexpr uint64_t INITIAL_CAPACITY = 8;
+
     common::transaction_t version;
-    std::array<common::sel_t, common::DEFAULT_VECTOR_CAPACITY> rowsInVector;
+    std::vector<common::sel_t> rowsInVector;
     common::sel_t numRowsUpdated;
+    bool isDelta;
+    // Rows written by the transaction of this version, as opposed to rows copied from older
+    // versions. Only kept when the version is not a delta, as a delta holds only its own rows.
+    std::vector<common::sel_t> ownRows;
     // Older versions.
     std::unique_ptr<VectorUpdateInfo> prev;
     // Newer versions.
@@ -31,12 +44,23 @@ struct VectorUpdateInfo {
     std::unique_ptr<ColumnChunkData> data;
 
     explicit VectorUpdateInfo(MemoryManager& memoryManager,
-        const common::transaction_t transactionID, common::LogicalType dataType)
-        : version{transactionID}, rowsInVector{}, numRowsUpdated{0}, prev{nullptr}, next{nullptr} {
+        const common::transaction_t transactionID, common::LogicalType dataType,
+        uint64_t capacity = INITIAL_CAPACITY)
+        : version{transactionID}, rowsInVector{}, numRowsUpdated{0}, isDelta{false}, prev{nullptr},
+          next{nullptr} {
         data = ColumnChunkFactory::createColumnChunkData(memoryManager, std::move(dataType), false,
-            common::DEFAULT_VECTOR_CAPACITY, ResidencyState::IN_MEMORY);
+            capacity, ResidencyState::IN_MEMORY);
     }
 
+    // Returns the index in `data` of the update of the given row, or INVALID_IDX.
+    common::idx_t findRow(common::sel_t rowInVector) const;
+    void appendRow(common::sel_t rowInVector, const common::ValueVector& values);
+    // Records that the row is written by the transaction of this version.
+    void addOwnRow(common::sel_t rowInVector);
+    bool isOwnRow(common::sel_t rowInVector) const;
+    // Copies the updates of another version, overwriting the values of rows updated in both.
+    void copyRows(const VectorUpdateInfo& other);
+
     std::unique_ptr<VectorUpdateInfo> movePrev() { return std::move(prev); }
     void setPrev(std::unique_ptr<VectorUpdateInfo> prev) { this->prev = std::move(prev); }
     VectorUpdateInfo* getPrev() const { return prev.get(); }
@@ -58,13 +82,22 @@ public:
     void clearVectorInfo(common::idx_t vectorIdx) { vectorsInfo[vectorIdx] = nullptr; }
 
     common::idx_t getNumVectors() const { return vectorsInfo.size(); }
+    // Returns the newest version of the vector visible to the transaction.
     VectorUpdateInfo* getVectorInfo(const transaction::Transaction* transaction,
         common::idx_t idx) const;
+    // Calls func on the versions of the vector that are needed to read its updates as seen by
+    // the transaction, from the oldest to the newest, so that newer values overwrite older ones.
+    void iterateVectorInfo(const transaction::Transaction* transaction, common::idx_t idx,
+        const std::function<void(const VectorUpdateInfo&)>& func) const;
 
     common::row_idx_t getNumUpdatedRows(const transaction::Transaction* transaction) const;
 
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
+    // Returns true if the row is updated by another transaction that is uncommitted or committed
+    // after the start of the given transaction.
+    bool isUpdatedByConcurrentTransaction(const transaction::Transaction* transaction,
+        common::idx_t vectorIdx, common::sel_t rowIdxInVector) const;
 
 private:
     VectorUpdateInfo& getOrCreateVectorInfo(MemoryManager& memoryManager,
@@ -65,10 +65,19 @@ struct VectorVersionInfo {
     // Given startTS and transactionID, if the row is readable to the transaction, return true.
     bool isInserted(common::transaction_t startTS, common::transaction_t transactionID,
         common::row_idx_t rowIdx) const;
+    // Given startTS and transactionID, if the row is deleted by another transaction that is
+    // uncommitted or committed after startTS, return true.
+    bool isDeletedByConcurrentTransaction(common::transaction_t startTS,
+        common::transaction_t transactionID, common::row_idx_t rowIdx) const;
 
     common::row_idx_t getNumDeletions(common::transaction_t startTS,
         common::transaction_t transactionID, common::row_idx_t startRow,
         common::length_t numRows) const;
+    // Number of rows that are both inserted and not deleted to the transaction. This agrees with
+    // the rows selected by `getSelVectorForScan`.
+    common::row_idx_t getNumVisibleRows(common::transaction_t startTS,
+        common::transaction_t transactionID, common::row_idx_t startRow,
+        common::length_t numRows) const;
 
     void serialize(common::Serializer& serializer) const;
     static std::unique_ptr<VectorVersionInfo> deSerialize(common::Deserializer& deSer);
@@ -100,10 +109,14 @@ public:
     bool hasDeletions() const;
     common::row_idx_t getNumDeletions(const transaction::Transaction* transaction,
         common::row_idx_t startRow, common::length_t numRows) const;
+    common::row_idx_t getNumVisibleRows(const transaction::Transaction* transaction,
+        common::row_idx_t startRow, common::length_t numRows) const;
     bool hasInsertions() const;
     bool isDeleted(const transaction::Transaction* transaction, common::row_idx_t rowInChunk) const;
     bool isInserted(const transaction::Transaction* transaction,
         common::row_idx_t rowInChunk) const;
+    bool isDeletedByConcurrentTransaction(const transaction::Transaction* transaction,
+        common::row_idx_t rowInChunk) const;
 
     bool hasDeletions(const transaction::Transaction* transaction) const;
 
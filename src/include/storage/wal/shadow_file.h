@@ -23,6 +23,9 @@ struct ShadowFileHeader {
 // NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
 class ShadowFile {
 public:
+    // Number of shadow pages read, and written back to db files, at a time during replay.
+    static constexpr uint64_t REPLAY_BATCH_NUM_PAGES = 256;
+
     ShadowFile(const std::string& directory, bool readOnly, BufferManager& bufferManager,
         common::VirtualFileSystem* vfs, main::ClientContext* context);
 
@@ -75,8 +75,13 @@ public:
 
     uint64_t getFileSize() const { return bufferedWriter->getFileSize(); }
 
+    // Validates the header written at the start of every WAL file, so that WAL files written by a
+    // build with a different storage version are not replayed.
+    static void validateHeader(common::Deserializer& deserializer);
+
 private:
     void addNewWALRecordNoLock(const WALRecord& walRecord);
+    void writeHeaderNoLock();
 
 private:
     // Keep track of tables that has updates since last checkpoint. Ideally this is used to
@@ -88,6 +93,7 @@ private:
     std::string directory;
     std::mutex mtx;
     common::VirtualFileSystem* vfs;
+    bool headerWritten;
 };
 
 } // namespace storage
@@ -11,6 +11,8 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/result_stream.h"
+#include "main/statement_cache.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
@@ -58,6 +60,7 @@ ClientContext::ClientContext(Database* database)
     clientConfig.fileSearchPath = "";
     clientConfig.enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
     clientConfig.enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
+    clientConfig.enableCardinalityFeedback = ClientConfigDefault::ENABLE_CARDINALITY_FEEDBACK;
     clientConfig.numThreads = database->dbConfig.maxNumThreads;
     clientConfig.timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
     clientConfig.varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
@@ -68,10 +71,13 @@ ClientContext::ClientContext(Database* database)
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
+    clientConfig.enableResultStreaming = ClientConfigDefault::ENABLE_RESULT_STREAMING;
     progressBar = std::make_unique<ProgressBar>(clientConfig.enableProgressBar);
 }
 
-ClientContext::~ClientContext() = default;
+ClientContext::~ClientContext() {
+    finishResultStreamNoLock();
+}
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
     KU_ASSERT(hasTimeout());
@@ -275,7 +281,8 @@ std::unique_ptr<QueryResult> ClientContext::queryInternal(std::string_view query
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
-        auto currentQueryResult = executeNoLock(preparedStatement.get(), 0u, queryID);
+        auto currentQueryResult = executeNoLock(preparedStatement.get(), 0u, queryID,
+            parsedStatements.size() == 1 /* allowStreaming */);
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -309,6 +316,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
     std::shared_ptr<Statement> parsedStatement, bool enumerateAllPlans,
     std::string_view encodedJoin, bool requireNewTx,
     std::optional<std::unordered_map<std::string, std::shared_ptr<Value>>> inputParams) {
+    finishResultStreamNoLock();
     auto preparedStatement = std::make_unique<PreparedStatement>();
     auto compilingTimer = TimeMetric(true /* enable */);
     compilingTimer.start();
@@ -384,6 +392,10 @@ std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_vi
     if (query.empty()) {
         throw ConnectionException("Query is empty.");
     }
+    auto statementCache = localDatabase->getStatementCache();
+    if (auto statement = statementCache->get(query)) {
+        return {std::move(statement)};
+    }
     std::vector<std::shared_ptr<Statement>> statements;
     bool startNewTrx = !transactionContext->hasActiveTransaction();
     if (startNewTrx) {
@@ -400,6 +412,9 @@ std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_vi
     if (startNewTrx) {
         transactionContext->commit();
     }
+    if (statements.size() == 1 && StatementCache::canCache(*statements[0])) {
+        statementCache->put(query, statements[0]);
+    }
     return statements;
 }
 
@@ -432,7 +447,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
-    return executeNoLock(rebindPreparedStatement.get(), 0u, queryID);
+    return executeNoLock(rebindPreparedStatement.get(), 0u, queryID, true /* allowStreaming */);
 }
 
 void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
@@ -451,7 +466,8 @@ void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
 }
 
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
-    uint32_t planIdx, std::optional<uint64_t> queryID) {
+    uint32_t planIdx, std::optional<uint64_t> queryID, bool allowStreaming) {
+    finishResultStreamNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -479,6 +495,21 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     }
     auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
     profiler->enabled = preparedStatement->isProfile();
+    if (allowStreaming && canStreamResult(preparedStatement)) {
+        try {
+            getTx()->checkForceCheckpoint(preparedStatement->getStatementType());
+        } catch (std::exception& e) {
+            transactionContext->rollback();
+            return queryResultWithError(e.what());
+        }
+        auto sResult = preparedStatement->statementResult.get();
+        queryResult->setColumnHeader(sResult->getColumnNames(), sResult->getColumnTypes());
+        resultStream = std::make_shared<ResultStream>(this, localDatabase->queryProcessor.get(),
+            std::move(physicalPlan), std::move(profiler), std::move(executionContext),
+            queryResult->querySummary.get());
+        queryResult->initResultStream(resultStream);
+        return queryResult;
+    }
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
@@ -512,7 +543,27 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
 
 // If there is an active transaction in the context, we execute the function in current active
 // transaction. If there is no active transaction, we start an auto commit transaction.
+bool ClientContext::canStreamResult(PreparedStatement* preparedStatement) const {
+#ifdef __SINGLE_THREADED__
+    // A streamed query executes on its own thread while the consumer reads the result.
+    (void)preparedStatement;
+    return false;
+#else
+    return clientConfig.enableResultStreaming && preparedStatement->isReadOnly() &&
+           preparedStatement->getStatementType() == StatementType::QUERY &&
+           !preparedStatement->isProfile();
+#endif
+}
+
+void ClientContext::finishResultStreamNoLock() {
+    if (resultStream) {
+        resultStream->finish();
+        resultStream.reset();
+    }
+}
+
 void ClientContext::runFuncInTransaction(const std::function<void(void)>& fun) {
+    finishResultStreamNoLock();
     // check if we are on AutoCommit. In this case we should start a transaction
     bool startNewTrx = !transactionContext->hasActiveTransaction();
     if (startNewTrx) {
@@ -13,6 +13,8 @@
 #include "common/file_system/virtual_file_system.h"
 #include "extension/extension.h"
 #include "main/db_config.h"
+#include "main/statement_cache.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "processor/processor.h"
 #include "storage/storage_extension.h"
 #include "storage/storage_manager.h"
@@ -27,9 +29,11 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold)
+    bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold,
+    bool scanResistantEviction)
     : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly{readOnly},
-      autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold} {
+      autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold},
+      scanResistantEviction{scanResistantEviction} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -82,7 +86,8 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
 std::unique_ptr<storage::BufferManager> Database::initBufferManager(const Database& db) {
     return std::make_unique<BufferManager>(db.databasePath,
         db.dbConfig.spillToDiskTmpFile.value_or(db.vfs->joinPath(db.databasePath, "copy.tmp")),
-        db.dbConfig.bufferPoolSize, db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly);
+        db.dbConfig.bufferPoolSize, db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly,
+        db.dbConfig.scanResistantEviction);
 }
 
 void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFunc) {
@@ -96,6 +101,8 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
     bufferManager = initBmFunc(*this);
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
     queryProcessor = std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads);
+    statementCache = std::make_unique<StatementCache>();
+    cardinalityFeedback = std::make_unique<planner::CardinalityFeedback>();
     catalog = std::make_unique<Catalog>(this->databasePath, vfs.get());
     storageManager = std::make_unique<StorageManager>(dbPathStr, dbConfig.readOnly, *catalog,
         *memoryManager, dbConfig.enableCompression, vfs.get(), &clientContext);
@@ -2,6 +2,7 @@
 
 #include "common/arrow/arrow_converter.h"
 #include "common/exception/runtime.h"
+#include "main/result_stream.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -19,7 +20,11 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary)
     querySummary->setPreparedSummary(preparedSummary);
 }
 
-QueryResult::~QueryResult() = default;
+QueryResult::~QueryResult() {
+    if (resultStream) {
+        resultStream->finish();
+    }
+}
 
 bool QueryResult::isSuccess() const {
     return success;
@@ -42,6 +47,9 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
+    if (resultStream) {
+        throw RuntimeException("The number of tuples is not known for a streamed query result.");
+    }
     return factorizedTable->getTotalNumFlatTuples();
 }
 
@@ -50,6 +58,9 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    if (resultStream) {
+        throw RuntimeException("Cannot reset the iterator of a streamed query result.");
+    }
     iterator->resetState();
 }
 
@@ -62,6 +73,15 @@ void QueryResult::setColumnHeader(std::vector<std::string> columnNames_,
 void QueryResult::initResultTableAndIterator(
     std::shared_ptr<processor::FactorizedTable> factorizedTable_) {
     factorizedTable = std::move(factorizedTable_);
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, initTuple());
+}
+
+void QueryResult::initResultStream(std::shared_ptr<ResultStream> resultStream_) {
+    resultStream = std::move(resultStream_);
+    resultStream->start(initTuple());
+}
+
+std::vector<Value*> QueryResult::initTuple() {
     tuple = std::make_shared<FlatTuple>();
     std::vector<Value*> valuesToCollect;
     for (auto& type : columnDataTypes) {
@@ -69,11 +89,14 @@ void QueryResult::initResultTableAndIterator(
         valuesToCollect.push_back(value.get());
         tuple->addValue(std::move(value));
     }
-    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
+    return valuesToCollect;
 }
 
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
+    if (resultStream) {
+        return resultStream->hasNext();
+    }
     return iterator->hasNextFlatTuple();
 }
 
@@ -95,7 +118,11 @@ std::shared_ptr<FlatTuple> QueryResult::getNext() {
             "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
     }
     validateQuerySucceed();
-    iterator->getNextFlatTuple();
+    if (resultStream) {
+        resultStream->getNext();
+    } else {
+        iterator->getNextFlatTuple();
+    }
     return tuple;
 }
 
@@ -110,7 +137,9 @@ std::string QueryResult::toString() {
             result += columnNames[i];
         }
         result += "\n";
-        resetIterator();
+        if (!resultStream) {
+            resetIterator();
+        }
         while (hasNext()) {
             getNext();
             result += tuple->toString();
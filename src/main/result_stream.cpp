@@ -0,0 +1,114 @@
+#include "main/result_stream.h"
+
+#include "common/exception/runtime.h"
+#include "common/metric.h"
+#include "common/profiler.h"
+#include "common/task_system/progress_bar.h"
+#include "main/client_context.h"
+#include "main/query_summary.h"
+#include "processor/operator/result_collector.h"
+#include "processor/physical_plan.h"
+#include "processor/processor.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+ResultStream::ResultStream(ClientContext* clientContext, QueryProcessor* queryProcessor,
+    std::unique_ptr<PhysicalPlan> physicalPlan, std::unique_ptr<Profiler> profiler,
+    std::unique_ptr<ExecutionContext> executionContext, QuerySummary* querySummary)
+    : clientContext{clientContext}, queryProcessor{queryProcessor},
+      physicalPlan{std::move(physicalPlan)}, profiler{std::move(profiler)},
+      executionContext{std::move(executionContext)}, querySummary{querySummary},
+      queue{std::make_shared<ResultChunkQueue>(CHUNK_QUEUE_CAPACITY)}, closed{false},
+      exhausted{false} {}
+
+ResultStream::~ResultStream() {
+    finish();
+}
+
+void ResultStream::start(std::vector<Value*> values) {
+    valuesToCollect = std::move(values);
+    auto resultCollector = ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get());
+    resultCollector->setChunkQueue(queue);
+    executionThread = std::thread([this] { execute(); });
+}
+
+void ResultStream::execute() {
+    auto transactionContext = clientContext->getTransactionContext();
+    auto executingTimer = TimeMetric(true /* enable */);
+    executingTimer.start();
+    try {
+        queryProcessor->execute(physicalPlan.get(), executionContext.get());
+        if (transactionContext->isAutoTransaction()) {
+            transactionContext->commit();
+        }
+    } catch (std::exception& e) {
+        clientContext->getProgressBar()->endProgress(executionContext->queryID);
+        // Closing the stream early is not an error of the query and must not abort a transaction
+        // the user started explicitly.
+        if (!closed || transactionContext->isAutoTransaction()) {
+            transactionContext->rollback();
+        }
+        if (!closed) {
+            errMsg = e.what();
+        }
+    }
+    clientContext->getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [](auto& spiller) { spiller.clearFile(); });
+    executingTimer.stop();
+    querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    queue->finish();
+}
+
+bool ResultStream::hasNext() {
+    while (iterator == nullptr || !iterator->hasNextFlatTuple()) {
+        if (exhausted) {
+            return false;
+        }
+        auto nextChunk = queue->pop();
+        if (closed) {
+            throw RuntimeException("Cannot read from a streamed query result after another "
+                                   "statement ran on the connection.");
+        }
+        if (nextChunk == nullptr) {
+            exhausted = true;
+            if (!errMsg.empty()) {
+                throw Exception(errMsg);
+            }
+            return false;
+        }
+        iterator.reset();
+        chunk = std::move(nextChunk);
+        iterator = std::make_unique<FlatTupleIterator>(*chunk, valuesToCollect);
+    }
+    return true;
+}
+
+void ResultStream::getNext() {
+    KU_ASSERT(iterator != nullptr && iterator->hasNextFlatTuple());
+    iterator->getNextFlatTuple();
+}
+
+void ResultStream::finish() {
+    std::unique_lock lck{mtx};
+    if (!executionThread.joinable()) {
+        return;
+    }
+    if (!exhausted) {
+        closed = true;
+        queue->close();
+        // Stop operators that do not produce output, e.g. hash join builds, as well.
+        clientContext->interrupt();
+    }
+    executionThread.join();
+}
+
+} // namespace main
+} // namespace kuzu
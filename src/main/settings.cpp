@@ -13,5 +13,13 @@ void SpillToDiskFileSetting::setContext(ClientContext* context, const common::Va
     context->getMemoryManager()->getBufferManager()->resetSpiller(dbConfig);
 }
 
+void ScanResistantEvictionSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->scanResistantEviction = parameter.getValue<bool>();
+    context->getMemoryManager()->getBufferManager()->setScanResistantEviction(
+        parameter.getValue<bool>());
+}
+
 } // namespace main
 } // namespace kuzu
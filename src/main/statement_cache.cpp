@@ -0,0 +1,74 @@
+#include "main/statement_cache.h"
+
+#include "parser/statement.h"
+
+using namespace kuzu::common;
+using namespace kuzu::parser;
+
+namespace kuzu {
+namespace main {
+
+std::shared_ptr<Statement> StatementCache::get(std::string_view query) {
+    std::unique_lock lck{mtx};
+    const auto itr = entryMap.find(normalize(query));
+    if (itr == entryMap.end()) {
+        numMisses++;
+        return nullptr;
+    }
+    numHits++;
+    entries.splice(entries.begin(), entries, itr->second);
+    return itr->second->second;
+}
+
+void StatementCache::put(std::string_view query, std::shared_ptr<Statement> statement) {
+    std::unique_lock lck{mtx};
+    const auto key = normalize(query);
+    if (entryMap.contains(key)) {
+        // Another connection parsed the same query concurrently.
+        return;
+    }
+    if (entries.size() == capacity) {
+        entryMap.erase(entries.back().first);
+        entries.pop_back();
+    }
+    entries.emplace_front(std::string(key), std::move(statement));
+    entryMap.emplace(entries.front().first, entries.begin());
+}
+
+void StatementCache::clear() {
+    std::unique_lock lck{mtx};
+    entryMap.clear();
+    entries.clear();
+}
+
+uint64_t StatementCache::getNumEntries() {
+    std::unique_lock lck{mtx};
+    return entries.size();
+}
+
+uint64_t StatementCache::getNumHits() {
+    std::unique_lock lck{mtx};
+    return numHits;
+}
+
+uint64_t StatementCache::getNumMisses() {
+    std::unique_lock lck{mtx};
+    return numMisses;
+}
+
+bool StatementCache::canCache(const Statement& statement) {
+    // Transforming DDL statements resolves user defined types through the catalog.
+    return statement.getStatementType() == StatementType::QUERY;
+}
+
+std::string_view StatementCache::normalize(std::string_view query) {
+    const auto start = query.find_first_not_of(" \t\n\r");
+    if (start == std::string_view::npos) {
+        return {};
+    }
+    const auto end = query.find_last_not_of(" \t\n\r");
+    return query.substr(start, end - start + 1);
+}
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,81 @@
+#include "optimizer/count_node_table_optimizer.h"
+
+#include "binder/expression/aggregate_function_expression.h"
+#include "function/aggregate/count_star.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/scan/logical_count_node_table.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::function;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void CountNodeTableOptimizer::rewrite(LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<LogicalOperator> CountNodeTableOptimizer::visitOperator(
+    const std::shared_ptr<LogicalOperator>& op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+// A projection can be skipped if it only passes through expressions computed by its child.
+static bool isPassThroughProjection(const LogicalOperator& op) {
+    auto& projection = op.constCast<LogicalProjection>();
+    auto& childSchema = *op.getChild(0)->getSchema();
+    for (auto& expression : projection.getExpressionsToProject()) {
+        if (!childSchema.isExpressionInScope(*expression)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<LogicalOperator> CountNodeTableOptimizer::visitAggregateReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto& aggregate = op->constCast<LogicalAggregate>();
+    if (aggregate.hasKeys() || aggregate.getAggregates().size() != 1) {
+        return op;
+    }
+    auto countExpr = aggregate.getAggregates()[0];
+    auto& aggregateFunction = countExpr->constCast<AggregateFunctionExpression>();
+    if (aggregateFunction.getFunction().name != CountStarFunction::name ||
+        aggregateFunction.isDistinct()) {
+        return op;
+    }
+    auto child = aggregate.getChild(0);
+    while (child->getOperatorType() == LogicalOperatorType::PROJECTION) {
+        if (!isPassThroughProjection(*child)) {
+            return op;
+        }
+        child = child->getChild(0);
+    }
+    if (child->getOperatorType() != LogicalOperatorType::SCAN_NODE_TABLE) {
+        return op;
+    }
+    auto& scan = child->constCast<LogicalScanNodeTable>();
+    if (scan.getScanType() != LogicalScanNodeTableType::SCAN || scan.getExtraInfo() != nullptr) {
+        return op;
+    }
+    for (auto& predicateSet : scan.getPropertyPredicates()) {
+        if (!predicateSet.isEmpty()) {
+            return op;
+        }
+    }
+    auto count = std::make_shared<LogicalCountNodeTable>(scan.getTableIDs(), countExpr);
+    count->computeFlatSchema();
+    return count;
+}
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,172 @@
+#include "optimizer/eager_aggregation_optimizer.h"
+
+#include "binder/expression/aggregate_function_expression.h"
+#include "catalog/catalog.h"
+#include "function/aggregate/count_star.h"
+#include "function/aggregate/sum.h"
+#include "function/aggregate_function.h"
+#include "function/built_in_function_utils.h"
+#include "main/client_context.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_projection.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void EagerAggregationOptimizer::rewrite(LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<LogicalOperator> EagerAggregationOptimizer::visitOperator(
+    const std::shared_ptr<LogicalOperator>& op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+static bool isCountStar(const Expression& expression) {
+    auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+    return aggregate.getFunction().name == CountStarFunction::name && !aggregate.isDistinct();
+}
+
+// Whether the aggregate can be computed from the join result with duplicates of build tuples
+// removed.
+static bool canAggregateEagerly(const Expression& expression) {
+    auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+    if (aggregate.isDistinct() || isCountStar(expression)) {
+        return true;
+    }
+    auto name = aggregate.getFunction().name;
+    return name == AggregateMinFunction::name || name == AggregateMaxFunction::name;
+}
+
+static bool isEvaluable(const Expression& expression, const Schema& schema) {
+    if (schema.isExpressionInScope(expression)) {
+        return true;
+    }
+    if (expression.getNumChildren() == 0) {
+        return expression.expressionType == ExpressionType::LITERAL ||
+               expression.expressionType == ExpressionType::PARAMETER;
+    }
+    for (auto& child : expression.getChildren()) {
+        if (!isEvaluable(*child, schema)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Pre-aggregation only pays off if the build side may produce the same key multiple times.
+static bool mayDuplicateKeys(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::RECURSIVE_EXTEND:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::CROSS_PRODUCT:
+        return true;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); ++i) {
+        if (mayDuplicateKeys(*op.getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<LogicalOperator> EagerAggregationOptimizer::visitAggregateReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto& aggregate = op->constCast<LogicalAggregate>();
+    // SUM over no tuple is NULL while COUNT(*) is 0, so we only rewrite grouped aggregates, which
+    // produce no group for an empty input.
+    if (!aggregate.hasKeys()) {
+        return op;
+    }
+    for (auto& expression : aggregate.getAggregates()) {
+        if (!canAggregateEagerly(*expression)) {
+            return op;
+        }
+    }
+    auto projection = aggregate.getChild(0);
+    if (projection->getOperatorType() != LogicalOperatorType::PROJECTION) {
+        return op;
+    }
+    auto hashJoinOp = projection->getChild(0);
+    if (hashJoinOp->getOperatorType() != LogicalOperatorType::HASH_JOIN ||
+        LogicalOperatorUtils::isAccHashJoin(*hashJoinOp)) {
+        return op;
+    }
+    auto& hashJoin = hashJoinOp->cast<LogicalHashJoin>();
+    if (hashJoin.getJoinType() != JoinType::INNER || !mayDuplicateKeys(*hashJoin.getChild(1))) {
+        return op;
+    }
+    auto& projectionOp = projection->constCast<LogicalProjection>();
+    auto expressionsToProject = projectionOp.getExpressionsToProject();
+    auto probeSchema = hashJoin.getChild(0)->getSchema();
+    for (auto& expression : expressionsToProject) {
+        if (!isEvaluable(*expression, *probeSchema)) {
+            return op;
+        }
+    }
+    expression_vector buildKeys;
+    for (auto& [_, buildKey] : hashJoin.getJoinConditions()) {
+        buildKeys.push_back(buildKey);
+    }
+    auto countStar = createCountStar(buildKeys);
+    auto buildAggregate = std::make_shared<LogicalAggregate>(buildKeys,
+        expression_vector{countStar}, hashJoin.getChild(1));
+    buildAggregate->computeFlatSchema();
+    hashJoin.setChild(1, buildAggregate);
+    // The recorded build side cardinality is for the un-aggregated subgraph, so it must not be
+    // overwritten with the number of distinct keys.
+    hashJoin.setBuildSideSignature("");
+    hashJoin.computeFlatSchema();
+    expression_vector aggregates;
+    for (auto& expression : aggregate.getAggregates()) {
+        if (!isCountStar(*expression)) {
+            aggregates.push_back(expression);
+            continue;
+        }
+        // Keep the unique name so that operators above still find the result.
+        auto function = AggregateFunctionUtils::getAggFunc<SumFunction<int64_t, int64_t>>(
+            AggregateSumFunction::name, LogicalTypeID::INT64, LogicalTypeID::INT64,
+            false /* isDistinct */);
+        auto bindData = std::make_unique<FunctionBindData>(LogicalType::INT64());
+        aggregates.push_back(std::make_shared<AggregateFunctionExpression>(function->copy(),
+            std::move(bindData), expression_vector{countStar}, expression->getUniqueName()));
+    }
+    expressionsToProject.push_back(countStar);
+    auto newProjection = std::make_shared<LogicalProjection>(expressionsToProject, hashJoinOp);
+    newProjection->computeFlatSchema();
+    return std::make_shared<LogicalAggregate>(aggregate.getKeys(), aggregate.getDependentKeys(),
+        aggregates, newProjection);
+}
+
+std::shared_ptr<Expression> EagerAggregationOptimizer::createCountStar(
+    const expression_vector& keys) {
+    auto functions = context->getCatalog()->getFunctions(context->getTx());
+    auto function = BuiltInFunctionsUtils::matchAggregateFunction(CountStarFunction::name,
+        std::vector<LogicalType>{}, false /* isDistinct */, functions);
+    auto bindData = std::make_unique<FunctionBindData>(LogicalType(function->returnTypeID));
+    // Prefix the name so that it does not collide with a COUNT(*) in the query.
+    auto uniqueName = "_eager_" +
+                      AggregateFunctionExpression::getUniqueName(CountStarFunction::name, keys,
+                          false /* isDistinct */);
+    return std::make_shared<AggregateFunctionExpression>(function->copy(), std::move(bindData),
+        expression_vector{}, uniqueName);
+}
+
+} // namespace optimizer
+} // namespace kuzu
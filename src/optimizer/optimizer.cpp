@@ -4,6 +4,8 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 #include "optimizer/agg_key_dependency_optimizer.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
+#include "optimizer/count_node_table_optimizer.h"
+#include "optimizer/eager_aggregation_optimizer.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
 #include "optimizer/limit_push_down_optimizer.h"
@@ -36,6 +38,14 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
     auto limitPushDownOptimizer = LimitPushDownOptimizer();
     limitPushDownOptimizer.rewrite(plan);
 
+    auto countNodeTableOptimizer = CountNodeTableOptimizer();
+    countNodeTableOptimizer.rewrite(plan);
+
+    // EagerAggregationOptimizer should be applied before HashJoinSIPOptimizer so that semi masks
+    // are planned for the rewritten build side.
+    auto eagerAggregationOptimizer = EagerAggregationOptimizer(context);
+    eagerAggregationOptimizer.rewrite(plan);
+
     if (context->getClientConfig()->enableSemiMask) {
         // HashJoinSIPOptimizer should be applied after optimizers that manipulate hash join.
         auto hashJoinSIPOptimizer = HashJoinSIPOptimizer();
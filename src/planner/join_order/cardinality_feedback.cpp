@@ -0,0 +1,35 @@
+#include "planner/join_order/cardinality_feedback.h"
+
+namespace kuzu {
+namespace planner {
+
+std::optional<uint64_t> CardinalityFeedback::getCardinality(const std::string& signature) {
+    std::unique_lock lck{mtx};
+    const auto itr = cardinalities.find(signature);
+    if (itr == cardinalities.end()) {
+        return std::nullopt;
+    }
+    return itr->second;
+}
+
+void CardinalityFeedback::setCardinality(const std::string& signature, uint64_t cardinality) {
+    std::unique_lock lck{mtx};
+    if (cardinalities.size() >= MAX_NUM_ENTRIES && !cardinalities.contains(signature)) {
+        // Observations are cheap to collect again, so we simply start over.
+        cardinalities.clear();
+    }
+    cardinalities[signature] = cardinality;
+}
+
+void CardinalityFeedback::clear() {
+    std::unique_lock lck{mtx};
+    cardinalities.clear();
+}
+
+uint64_t CardinalityFeedback::getNumEntries() {
+    std::unique_lock lck{mtx};
+    return cardinalities.size();
+}
+
+} // namespace planner
+} // namespace kuzu
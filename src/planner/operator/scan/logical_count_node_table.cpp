@@ -0,0 +1,13 @@
+#include "planner/operator/scan/logical_count_node_table.h"
+
+namespace kuzu {
+namespace planner {
+
+void LogicalCountNodeTable::computeSchema() {
+    createEmptySchema();
+    schema->createGroup();
+    schema->insertToGroupAndScope(countExpr, 0);
+}
+
+} // namespace planner
+} // namespace kuzu
@@ -3,9 +3,12 @@
 #include "binder/expression_visitor.h"
 #include "common/enums/join_type.h"
 #include "main/client_context.h"
+#include "main/database.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
 
@@ -132,6 +135,10 @@ std::vector<std::unique_ptr<LogicalPlan>> Planner::enumerateQueryGraphCollection
 std::vector<std::unique_ptr<LogicalPlan>> Planner::enumerateQueryGraph(const QueryGraph& queryGraph,
     const QueryGraphPlanningInfo& info) {
     context.init(&queryGraph, info.predicates);
+    // Correlated subquery graphs are evaluated once for each outer tuple, so their observed
+    // cardinalities do not carry over between executions.
+    context.useCardinalityFeedback = clientContext->getClientConfig()->enableCardinalityFeedback &&
+                                     info.subqueryType == SubqueryType::NONE;
     cardinalityEstimator.initNodeIDDom(clientContext->getTx(), queryGraph);
     if (info.hint != nullptr) {
         auto constructor = JoinTreeConstructor(queryGraph, propertyExprCollection, info.predicates);
@@ -142,9 +149,10 @@ std::vector<std::unique_ptr<LogicalPlan>> Planner::enumerateQueryGraph(const Que
         return result;
     }
     planBaseTableScans(info);
-    context.currentLevel++;
+    applyCardinalityFeedback(context.currentLevel++);
     while (context.currentLevel < context.maxLevel) {
-        planLevel(context.currentLevel++);
+        planLevel(context.currentLevel);
+        applyCardinalityFeedback(context.currentLevel++);
     }
     auto plans = std::move(context.getPlans(context.getFullyMatchedSubqueryGraph()));
     if (queryGraph.isEmpty()) {
@@ -176,9 +184,70 @@ void Planner::planLevelExactly(uint32_t level) {
 }
 
 void Planner::planLevelApproximately(uint32_t level) {
+    // Exhaustive enumeration is too expensive for large query graphs, so we only extend the
+    // cheapest subgraphs of the previous level by one variable.
+    auto numSubgraphsToExtend =
+        context.subPlansTable->getNumPlansEnumerated() > MAX_NUM_PLANS_TO_ENUMERATE ?
+            1 :
+            MAX_NUM_SUBGRAPHS_TO_EXTEND;
+    context.subPlansTable->pruneLevel(level - 1, numSubgraphsToExtend);
     planInnerJoin(1, level - 1);
 }
 
+void Planner::applyCardinalityFeedback(uint32_t level) {
+    if (!context.useCardinalityFeedback) {
+        return;
+    }
+    auto cardinalityFeedback = clientContext->getDatabase()->getCardinalityFeedback();
+    if (cardinalityFeedback->getNumEntries() == 0) {
+        return;
+    }
+    for (auto& subgraph : context.subPlansTable->getSubqueryGraphs(level)) {
+        auto cardinality = cardinalityFeedback->getCardinality(getSubqueryGraphSignature(subgraph));
+        if (!cardinality.has_value()) {
+            continue;
+        }
+        // Plans of the same subquery graph produce the same tuples. Subsequent levels derive
+        // their estimates from this level, so corrections propagate to larger subquery graphs.
+        for (auto& plan : context.getPlans(subgraph)) {
+            plan->setCardinality(std::max<cardinality_t>(cardinality.value(), 1));
+        }
+    }
+}
+
+static std::string getTableIDsSignature(const std::vector<table_id_t>& tableIDs) {
+    std::string result;
+    for (auto tableID : tableIDs) {
+        result += std::to_string(tableID) + ",";
+    }
+    return result;
+}
+
+std::string Planner::getSubqueryGraphSignature(const SubqueryGraph& subgraph) {
+    auto queryGraph = context.getQueryGraph();
+    std::string result;
+    for (auto i = 0u; i < queryGraph->getNumQueryNodes(); ++i) {
+        if (subgraph.queryNodesSelector[i]) {
+            auto node = queryGraph->getQueryNode(i);
+            result += "(" + node->getUniqueName() + ":" +
+                      getTableIDsSignature(node->getTableIDs()) + ")";
+        }
+    }
+    for (auto i = 0u; i < queryGraph->getNumQueryRels(); ++i) {
+        if (subgraph.queryRelsSelector[i]) {
+            auto rel = queryGraph->getQueryRel(i);
+            result += "[" + rel->getSrcNodeName() + "-" + rel->getUniqueName() + ":" +
+                      getTableIDsSignature(rel->getTableIDs()) + "-" + rel->getDstNodeName() +
+                      "]";
+        }
+    }
+    for (auto& predicate : getNewlyMatchedExprs(context.getEmptySubqueryGraph(), subgraph,
+             context.getWhereExpressions())) {
+        result += "{" + predicate->toString() + "}";
+    }
+    return result;
+}
+
 void Planner::planBaseTableScans(const QueryGraphPlanningInfo& info) {
     auto queryGraph = context.getQueryGraph();
     auto& corrExprs = info.corrExprs;
@@ -568,6 +637,11 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
     }
     auto predicates =
         getNewlyMatchedExprs(subgraph, otherSubgraph, newSubgraph, context.getWhereExpressions());
+    std::string subgraphSignature, otherSubgraphSignature;
+    if (context.useCardinalityFeedback) {
+        subgraphSignature = getSubqueryGraphSignature(subgraph);
+        otherSubgraphSignature = getSubqueryGraphSignature(otherSubgraph);
+    }
     for (auto& leftPlan : context.getPlans(subgraph)) {
         for (auto& rightPlan : context.getPlans(otherSubgraph)) {
             if (CostModel::computeHashJoinCost(joinNodeIDs, *leftPlan, *rightPlan) < maxCost) {
@@ -575,6 +649,8 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanBuildCopy = rightPlan->shallowCopy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, *leftPlanProbeCopy,
                     *rightPlanBuildCopy, *leftPlanProbeCopy);
+                auto& hashJoin = leftPlanProbeCopy->getLastOperator()->cast<LogicalHashJoin>();
+                hashJoin.setBuildSideSignature(otherSubgraphSignature);
                 appendFilters(predicates, *leftPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
             }
@@ -585,6 +661,8 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanProbeCopy = rightPlan->shallowCopy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, *rightPlanProbeCopy,
                     *leftPlanBuildCopy, *rightPlanProbeCopy);
+                auto& hashJoin = rightPlanProbeCopy->getLastOperator()->cast<LogicalHashJoin>();
+                hashJoin.setBuildSideSignature(subgraphSignature);
                 appendFilters(predicates, *rightPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
             }
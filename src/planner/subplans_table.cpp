@@ -1,5 +1,7 @@
 #include "planner/subplans_table.h"
 
+#include <algorithm>
+
 using namespace kuzu::binder;
 
 namespace kuzu {
@@ -14,6 +16,14 @@ SubgraphPlans::SubgraphPlans(const kuzu::binder::SubqueryGraph& subqueryGraph) {
     maxCost = UINT64_MAX;
 }
 
+uint64_t SubgraphPlans::getMinCost() const {
+    auto minCost = UINT64_MAX;
+    for (auto& plan : plans) {
+        minCost = std::min(minCost, plan->getCost());
+    }
+    return minCost;
+}
+
 void SubgraphPlans::addPlan(std::unique_ptr<LogicalPlan> plan) {
     if (plans.size() > MAX_NUM_PLANS) {
         return;
@@ -61,15 +71,56 @@ std::vector<SubqueryGraph> DPLevel::getSubqueryGraphs() {
 
 void DPLevel::addPlan(const kuzu::binder::SubqueryGraph& subqueryGraph,
     std::unique_ptr<LogicalPlan> plan) {
-    if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
-        return;
-    }
     if (!contains(subqueryGraph)) {
+        if (subgraph2Plans.size() >= MAX_NUM_SUBGRAPH && !tryEvictSubgraph(plan->getCost())) {
+            return;
+        }
         subgraph2Plans.insert({subqueryGraph, std::make_unique<SubgraphPlans>(subqueryGraph)});
     }
     subgraph2Plans.at(subqueryGraph)->addPlan(std::move(plan));
 }
 
+void DPLevel::prune(uint64_t maxNumSubgraphs) {
+    KU_ASSERT(maxNumSubgraphs > 0);
+    if (subgraph2Plans.size() <= maxNumSubgraphs) {
+        return;
+    }
+    std::vector<uint64_t> minCosts;
+    for (auto& [_, subgraphPlans] : subgraph2Plans) {
+        minCosts.push_back(subgraphPlans->getMinCost());
+    }
+    std::nth_element(minCosts.begin(), minCosts.begin() + maxNumSubgraphs - 1, minCosts.end());
+    const auto maxCostToKeep = minCosts[maxNumSubgraphs - 1];
+    // Subgraphs tied with the last one kept are removed in enumeration order.
+    auto numKept = 0u;
+    for (auto itr = subgraph2Plans.begin(); itr != subgraph2Plans.end();) {
+        const auto minCost = itr->second->getMinCost();
+        if (minCost < maxCostToKeep || (minCost == maxCostToKeep && numKept < maxNumSubgraphs)) {
+            numKept++;
+            ++itr;
+        } else {
+            itr = subgraph2Plans.erase(itr);
+        }
+    }
+}
+
+bool DPLevel::tryEvictSubgraph(uint64_t cost) {
+    auto itrToEvict = subgraph2Plans.end();
+    auto maxMinCost = cost;
+    for (auto itr = subgraph2Plans.begin(); itr != subgraph2Plans.end(); ++itr) {
+        const auto minCost = itr->second->getMinCost();
+        if (minCost > maxMinCost) {
+            maxMinCost = minCost;
+            itrToEvict = itr;
+        }
+    }
+    if (itrToEvict == subgraph2Plans.end()) {
+        return false;
+    }
+    subgraph2Plans.erase(itrToEvict);
+    return true;
+}
+
 void SubPlansTable::resize(uint32_t newSize) {
     auto prevSize = dpLevels.size();
     dpLevels.resize(newSize);
@@ -102,12 +153,18 @@ std::vector<SubqueryGraph> SubPlansTable::getSubqueryGraphs(uint32_t level) {
 void SubPlansTable::addPlan(const SubqueryGraph& subqueryGraph, std::unique_ptr<LogicalPlan> plan) {
     auto dpLevel = getDPLevel(subqueryGraph);
     dpLevel->addPlan(subqueryGraph, std::move(plan));
+    numPlansEnumerated++;
+}
+
+void SubPlansTable::pruneLevel(uint32_t level, uint64_t maxNumSubgraphs) {
+    dpLevels[level]->prune(maxNumSubgraphs);
 }
 
 void SubPlansTable::clear() {
     for (auto& dpLevel : dpLevels) {
         dpLevel->clear();
     }
+    numPlansEnumerated = 0;
 }
 
 } // namespace planner
@@ -0,0 +1,28 @@
+#include "planner/operator/scan/logical_count_node_table.h"
+#include "processor/operator/scan/count_node_table.h"
+#include "processor/plan_mapper.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::mapCountNodeTable(LogicalOperator* logicalOperator) {
+    auto storageManager = clientContext->getStorageManager();
+    auto& count = logicalOperator->constCast<LogicalCountNodeTable>();
+    std::vector<storage::NodeTable*> tables;
+    std::vector<std::string> tableNames;
+    for (auto& tableID : count.getTableIDs()) {
+        auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
+        tables.push_back(table);
+        tableNames.push_back(table->getTableName());
+    }
+    auto outputPos = getDataPos(*count.getCountExpr(), *count.getSchema());
+    auto printInfo = std::make_unique<CountNodeTablePrintInfo>(std::move(tableNames));
+    return std::make_unique<CountNodeTable>(std::move(tables), outputPos, getOperatorID(),
+        std::move(printInfo));
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -83,6 +83,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
     // Create build
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
+    // A semi mask passed from the probe side filters the build side, in which case the number of
+    // tuples built is not the cardinality of the build side plan.
+    if (hashJoin->getSIPInfo().direction != SIPDirection::PROBE_TO_BUILD) {
+        buildInfo->setBuildSideSignature(hashJoin->getBuildSideSignature());
+    }
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
@@ -1,6 +1,9 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "planner/join_order/cardinality_feedback.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -51,10 +54,17 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
+void HashJoinBuild::finalizeInternal(ExecutionContext* context) {
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    if (!info->buildSideSignature.empty()) {
+        // Unflat payloads are stored as lists, so count flat tuples to match planner estimates.
+        auto numFlatTuples =
+            sharedState->getHashTable()->getFactorizedTable()->getTotalNumFlatTuples();
+        context->clientContext->getDatabase()->getCardinalityFeedback()->setCardinality(
+            info->buildSideSignature, numFlatTuples);
+    }
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -1,5 +1,7 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <bit>
+
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
 
@@ -112,6 +114,18 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     while (hashSlotsBlocks.size() < numBlocksNeeded) {
         hashSlotsBlocks.emplace_back(std::make_unique<DataBlock>(&memoryManager, HASH_BLOCK_SIZE));
     }
+    allocateBloomFilter(numTuples);
+}
+
+void JoinHashTable::allocateBloomFilter(uint64_t numTuples) {
+    bloomFilter.reset();
+    if (numTuples < MIN_NUM_TUPLES_FOR_BLOOM_FILTER) {
+        return;
+    }
+    const auto numWords = nextPowerOfTwo(numTuples * BLOOM_FILTER_NUM_BITS_PER_TUPLE / 64);
+    bloomFilter = memoryManager.allocateBuffer(true /* initializeToZero */,
+        numWords * sizeof(uint64_t));
+    bloomFilterWordIdxShift = 64 - std::countr_zero(numWords);
 }
 
 void JoinHashTable::buildHashSlots() {
@@ -119,6 +133,10 @@ void JoinHashTable::buildHashSlots() {
         uint8_t* tuple = tupleBlock->getData();
         for (auto i = 0u; i < tupleBlock->numTuples; i++) {
             auto lastSlotEntryInHT = insertEntry(tuple);
+            if (bloomFilter) {
+                const auto hash = *(hash_t*)(tuple + getHashValueColOffset());
+                getBloomFilterWords()[hash >> bloomFilterWordIdxShift] |= getBloomFilterMask(hash);
+            }
             auto prevPtr = getPrevTuple(tuple);
             memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
                 sizeof(uint8_t*));
@@ -148,7 +166,8 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
     }
     for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
+        const auto hash = hashVector.getValue<hash_t>(hashSelVec[i]);
+        probedTuples[i] = mayContainHash(hash) ? getTupleForHash(hash) : nullptr;
     }
 }
 
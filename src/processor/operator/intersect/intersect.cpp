@@ -61,27 +61,64 @@ void Intersect::probeHTs() {
     }
 }
 
+// Returns the first position in [startPos, size) whose offset is not smaller than offset, or size
+// if there is none. Probes positions at exponentially growing distances from startPos first, so
+// that the cost is logarithmic in the distance skipped rather than in the size of the list.
+static sel_t gallopToOffset(const nodeID_t* nodeIDs, sel_t startPos, sel_t size, offset_t offset) {
+    sel_t step = 1;
+    auto pos = startPos;
+    while (pos + step < size && nodeIDs[pos + step].offset < offset) {
+        pos += step;
+        step *= 2;
+    }
+    auto endPos = std::min<sel_t>(pos + step + 1, size);
+    return std::lower_bound(nodeIDs + pos, nodeIDs + endPos, offset,
+               [](const nodeID_t& nodeID, offset_t value) { return nodeID.offset < value; }) -
+           nodeIDs;
+}
+
 void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
     auto leftPositionBuffer = lSelVector.getMutableBuffer();
     auto rightPositionBuffer = rSelVector.getMutableBuffer();
+    auto leftSize = lSelVector.getSelSize();
+    auto rightSize = rSelVector.getSelSize();
     sel_t leftPosition = 0, rightPosition = 0;
     uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
-        auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID.offset < rightNodeID.offset) {
-            leftPosition++;
-        } else if (leftNodeID.offset > rightNodeID.offset) {
-            rightPosition++;
-        } else {
+    if ((uint64_t)leftSize * GALLOPING_SIZE_RATIO < rightSize) {
+        // The left list is much shorter, so search for each of its values in the right list
+        // instead of walking the right list linearly.
+        for (; leftPosition < leftSize; leftPosition++) {
+            auto leftNodeID = leftNodeIDs[leftPosition];
+            rightPosition =
+                gallopToOffset(rightNodeIDs, rightPosition, rightSize, leftNodeID.offset);
+            if (rightPosition == rightSize) {
+                break;
+            }
+            if (rightNodeIDs[rightPosition].offset == leftNodeID.offset) {
+                leftPositionBuffer[outputValuePosition] = leftPosition;
+                rightPositionBuffer[outputValuePosition] = rightPosition;
+                leftNodeIDs[outputValuePosition] = leftNodeID;
+                rightPosition++;
+                outputValuePosition++;
+            }
+        }
+    } else {
+        // Branch-free merge: the output slot is always written and only kept if the offsets match,
+        // and each cursor advances by the result of a comparison. This avoids the unpredictable
+        // three-way branch of a textbook merge, which dominates when lists have similar sizes.
+        // Writing leftNodeIDs in place is safe because outputValuePosition <= leftPosition.
+        while (leftPosition < leftSize && rightPosition < rightSize) {
+            auto leftNodeID = leftNodeIDs[leftPosition];
+            auto leftOffset = leftNodeID.offset;
+            auto rightOffset = rightNodeIDs[rightPosition].offset;
             leftPositionBuffer[outputValuePosition] = leftPosition;
             rightPositionBuffer[outputValuePosition] = rightPosition;
             leftNodeIDs[outputValuePosition] = leftNodeID;
-            leftPosition++;
-            rightPosition++;
-            outputValuePosition++;
+            outputValuePosition += leftOffset == rightOffset;
+            leftPosition += leftOffset <= rightOffset;
+            rightPosition += rightOffset <= leftOffset;
         }
     }
     lSelVector.setToFiltered(outputValuePosition);
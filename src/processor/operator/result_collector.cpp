@@ -1,6 +1,7 @@
 #include "processor/operator/result_collector.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/interrupt.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -37,19 +38,40 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    auto chunkQueue = sharedState->getChunkQueue();
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            if (chunkQueue && localTable->getNumTuples() >= STREAMING_CHUNK_SIZE) {
+                pushLocalTable(*chunkQueue, context);
+            }
         }
     }
-    if (!payloadVectors.empty()) {
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (chunkQueue) {
+        if (!localTable->isEmpty()) {
+            pushLocalTable(*chunkQueue, context);
+        }
+    } else {
         metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
         sharedState->mergeLocalTable(*localTable);
     }
 }
 
+void ResultCollector::pushLocalTable(ResultChunkQueue& queue, ExecutionContext* context) {
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    if (!queue.push(std::move(localTable))) {
+        // The consumer stopped reading the result.
+        throw InterruptException();
+    }
+    localTable = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+        info.tableSchema.copy());
+}
+
 void ResultCollector::finalizeInternal(ExecutionContext* /*context*/) {
     switch (info.accumulateType) {
     case AccumulateType::OPTIONAL_: {
@@ -0,0 +1,35 @@
+#include "processor/operator/scan/count_node_table.h"
+
+#include "common/string_utils.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+std::string CountNodeTablePrintInfo::toString() const {
+    return "Tables: " + StringUtils::join(tableNames, ", ");
+}
+
+void CountNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
+    outputVector = resultSet->getValueVector(outputPos).get();
+}
+
+bool CountNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    if (executed) {
+        return false;
+    }
+    executed = true;
+    auto transaction = context->clientContext->getTx();
+    int64_t numNodes = 0;
+    for (auto& table : tables) {
+        numNodes += table->getNumVisibleRows(transaction);
+    }
+    outputVector->state->initOriginalAndSelectedSize(1);
+    outputVector->setValue<int64_t>(0, numNodes);
+    metrics->numOutputTuple.incrementByOne();
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
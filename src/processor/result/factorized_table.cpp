@@ -1,5 +1,7 @@
 #include "processor/result/factorized_table.h"
 
+#include <algorithm>
+
 #include "common/assert.h"
 #include "common/exception/runtime.h"
 #include "common/null_buffer.h"
@@ -185,6 +187,11 @@ bool FactorizedTable::hasUnflatCol() const {
 }
 
 uint64_t FactorizedTable::getTotalNumFlatTuples() const {
+    // Each tuple of a table without unflat columns is a single flat tuple, so there is no need to
+    // read the tuples. This is the common case for query results.
+    if (!hasUnflatCol()) {
+        return getNumTuples();
+    }
     auto totalNumFlatTuples = 0ul;
     for (auto i = 0u; i < getNumTuples(); i++) {
         totalNumFlatTuples += getNumFlatTuples(i);
@@ -193,14 +200,16 @@ uint64_t FactorizedTable::getTotalNumFlatTuples() const {
 }
 
 uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
-    std::unordered_map<uint32_t, bool> calculatedGroups;
+    // Tables have few columns, so a linear search over the groups is cheaper than hashing them.
+    std::vector<uint32_t> calculatedGroups;
     uint64_t numFlatTuples = 1;
     auto tupleBuffer = getTuple(tupleIdx);
     for (auto i = 0u; i < tableSchema.getNumColumns(); i++) {
         auto column = tableSchema.getColumn(i);
         auto groupID = column->getGroupID();
-        if (!calculatedGroups.contains(groupID)) {
-            calculatedGroups[groupID] = true;
+        if (std::find(calculatedGroups.begin(), calculatedGroups.end(), groupID) ==
+            calculatedGroups.end()) {
+            calculatedGroups.push_back(groupID);
             numFlatTuples *= column->isFlat() ? 1 : ((overflow_value_t*)tupleBuffer)->numElements;
         }
         tupleBuffer += column->getNumBytes();
@@ -601,6 +610,20 @@ void FlatTupleIterator::resetState() {
     }
 }
 
+void FlatTupleIterator::skipTuples(uint64_t numTuplesToSkip) {
+    KU_ASSERT(!factorizedTable.hasUnflatCol());
+    if (numTuplesToSkip == 0) {
+        return;
+    }
+    const auto lastTupleIdx = getNextTupleIdx() + numTuplesToSkip - 1;
+    KU_ASSERT(lastTupleIdx < factorizedTable.getNumTuples());
+    // Leave the iterator in the state it has after reading the last skipped tuple.
+    currentTupleBuffer = factorizedTable.getTuple(lastTupleIdx);
+    numFlatTuples = 1;
+    nextFlatTupleIdx = 1;
+    nextTupleIdx = lastTupleIdx + 1;
+}
+
 void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer) {
     auto overflowValue =
         (overflow_value_t*)(valueBuffer + factorizedTable.getTableSchema()->getColOffset(colIdx));
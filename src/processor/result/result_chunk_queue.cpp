@@ -0,0 +1,44 @@
+#include "processor/result/result_chunk_queue.h"
+
+namespace kuzu {
+namespace processor {
+
+bool ResultChunkQueue::push(std::unique_ptr<FactorizedTable> chunk) {
+    std::unique_lock lck{mtx};
+    notFull.wait(lck, [&] { return closed || chunks.size() < capacity; });
+    if (closed) {
+        return false;
+    }
+    chunks.push_back(std::move(chunk));
+    notEmpty.notify_one();
+    return true;
+}
+
+std::unique_ptr<FactorizedTable> ResultChunkQueue::pop() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&] { return closed || finished || !chunks.empty(); });
+    if (chunks.empty()) {
+        return nullptr;
+    }
+    auto chunk = std::move(chunks.front());
+    chunks.pop_front();
+    notFull.notify_one();
+    return chunk;
+}
+
+void ResultChunkQueue::finish() {
+    std::unique_lock lck{mtx};
+    finished = true;
+    notEmpty.notify_all();
+}
+
+void ResultChunkQueue::close() {
+    std::unique_lock lck{mtx};
+    closed = true;
+    chunks.clear();
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <cstring>
@@ -80,9 +81,11 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 }
 
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
+    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly,
+    bool scanResistantEviction)
     : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / KUZU_PAGE_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
+      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs},
+      scanResistantEviction{scanResistantEviction} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
@@ -217,7 +220,8 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageAccessHint accessHint) {
+    const auto keepMark = accessHint == PageAccessHint::SCAN && scanResistantEviction;
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
@@ -236,13 +240,31 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
             }
         } break;
         case PageState::MARKED: {
+            if (keepMark) {
+                // Read the page without giving it a second chance. Eviction has to lock the page
+                // first, so the version check below detects if it was evicted during the read.
+                if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
+                        fileHandle.getPageSizeClass())) {
+                    continue;
+                }
+                if (pageState->getStateAndVersion() == currStateAndVersion) {
+                    return;
+                }
+                continue;
+            }
             // If the page is marked, we try to switch to unlocked.
             pageState->tryClearMark(currStateAndVersion);
             continue;
         }
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
-            unpin(fileHandle, pageIdx);
+            if (keepMark) {
+                // Pages loaded by scans enter the eviction queue MARKED, so they are evicted before
+                // pages that were read by lookups.
+                pageState->unlockAndMark();
+            } else {
+                unpin(fileHandle, pageIdx);
+            }
         } break;
         default: {
             // When locked, continue the spinning.
@@ -252,11 +274,95 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
     }
 }
 
+bool BufferManager::optimisticReadPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages, const std::function<void(uint8_t*)>& func, PageAccessHint accessHint) {
+    KU_ASSERT(numPages > 0 && numPages <= MAX_NUM_PAGES_PER_EXTENT_READ);
+    KU_ASSERT((startPageIdx >> StorageConstants::PAGE_GROUP_SIZE_LOG2) ==
+              ((startPageIdx + numPages - 1) >> StorageConstants::PAGE_GROUP_SIZE_LOG2));
+    const auto keepMark = accessHint == PageAccessHint::SCAN && scanResistantEviction;
+    std::array<uint64_t, MAX_NUM_PAGES_PER_EXTENT_READ> statesAndVersions{};
+    for (auto i = 0u; i < numPages; i++) {
+        auto pageState = fileHandle.getPageState(startPageIdx + i);
+        auto currStateAndVersion = pageState->getStateAndVersion();
+        if (PageState::getState(currStateAndVersion) == PageState::MARKED && !keepMark) {
+            pageState->tryClearMark(currStateAndVersion);
+            currStateAndVersion = pageState->getStateAndVersion();
+        }
+        const auto state = PageState::getState(currStateAndVersion);
+        if (state != PageState::UNLOCKED && state != PageState::MARKED) {
+            return false;
+        }
+        statesAndVersions[i] = currStateAndVersion;
+    }
+#if defined(_WIN32)
+    auto translator = ScopedTranslator(handleAccessViolation);
+#endif
+    if (!try_func(func, getFrame(fileHandle, startPageIdx), vmRegions,
+            fileHandle.getPageSizeClass())) {
+        return false;
+    }
+    for (auto i = 0u; i < numPages; i++) {
+        if (fileHandle.getPageState(startPageIdx + i)->getStateAndVersion() !=
+            statesAndVersions[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BufferManager::unpin(FileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->unlock();
 }
 
+// Prefetching is best-effort: pages that are cached or locked by other threads are skipped, and
+// prefetching stops once the buffer pool has no free memory left, so that read-ahead never evicts
+// pages that are in use in favour of pages that may not be read. With scan resistant eviction,
+// prefetched pages enter the eviction queue MARKED, the same as pages loaded by scans.
+void BufferManager::prefetchPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    const auto endPageIdx =
+        std::min<page_idx_t>(startPageIdx + numPages, fileHandle.getNumPages());
+    auto pageIdx = startPageIdx;
+    while (pageIdx < endPageIdx) {
+        // Lock a run of adjacent evicted pages. Frames are only contiguous within a page group, so
+        // a run is cut at page group boundaries.
+        const auto runStartPageIdx = pageIdx;
+        while (pageIdx < endPageIdx) {
+            if (pageIdx != runStartPageIdx &&
+                (pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) == 0) {
+                break;
+            }
+            auto pageState = fileHandle.getPageState(pageIdx);
+            auto currStateAndVersion = pageState->getStateAndVersion();
+            if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+                !pageState->tryLock(currStateAndVersion)) {
+                break;
+            }
+            pageIdx++;
+        }
+        const auto numPagesInRun = pageIdx - runStartPageIdx;
+        if (numPagesInRun == 0) {
+            pageIdx++;
+            continue;
+        }
+        if (!cachePagesIntoFrames(fileHandle, runStartPageIdx, numPagesInRun)) {
+            return;
+        }
+        for (auto i = runStartPageIdx; i < pageIdx; i++) {
+            if (!evictionQueue.insert(fileHandle.getFileIndex(), i)) {
+                throw BufferManagerException(
+                    "Eviction queue is full! This should be impossible.");
+            }
+            if (scanResistantEviction) {
+                fileHandle.getPageState(i)->unlockAndMark();
+            } else {
+                unpin(fileHandle, i);
+            }
+        }
+    }
+}
+
 // evicts up to 64 pages and returns the space reclaimed
 uint64_t BufferManager::evictPages() {
     constexpr size_t BATCH_SIZE = 64;
@@ -413,6 +519,48 @@ void BufferManager::cachePageIntoFrame(FileHandle& fileHandle, page_idx_t pageId
     }
 }
 
+bool BufferManager::cachePagesIntoFrames(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    const auto endPageIdx = startPageIdx + numPages;
+    const auto sizeToClaim = numPages * fileHandle.getPageSize();
+    const auto resetPagesToEvicted = [&]() {
+        for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+            fileHandle.getPageState(pageIdx)->resetToEvicted();
+        }
+    };
+    // Only use memory that is free. Unlike reserve(), we don't evict to make room for read-ahead.
+    if (usedMemory.fetch_add(sizeToClaim) + sizeToClaim > bufferPoolSize.load()) {
+        freeUsedMemory(sizeToClaim);
+        resetPagesToEvicted();
+        return false;
+    }
+    const auto frame = getFrame(fileHandle, startPageIdx);
+#ifdef _WIN32
+    auto result = VirtualAlloc(frame, sizeToClaim, MEM_COMMIT, PAGE_READWRITE);
+    if (result == NULL) {
+        freeUsedMemory(sizeToClaim);
+        resetPagesToEvicted();
+        throw BufferManagerException(
+            stringFormat("VirtualAlloc MEM_COMMIT failed with error code {}: {}.", GetLastError(),
+                std::system_category().message(GetLastError())));
+    }
+#endif
+    try {
+        fileHandle.readPagesFromDisk(frame, startPageIdx, numPages);
+    } catch (...) {
+        for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+            releaseFrameForPage(fileHandle, pageIdx);
+        }
+        freeUsedMemory(sizeToClaim);
+        resetPagesToEvicted();
+        throw;
+    }
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+        fileHandle.getPageState(pageIdx)->clearDirty();
+    }
+    return true;
+}
+
 void BufferManager::removeFilePagesFromFrames(FileHandle& fileHandle) {
     evictionQueue.removeCandidatesForFile(fileHandle.getFileIndex());
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
@@ -108,6 +108,29 @@ std::unique_ptr<ExtraMetadata> ALPMetadata::copy() {
     return std::make_unique<ALPMetadata>(*this);
 }
 
+void FSSTMetadata::serialize(common::Serializer& serializer) const {
+    serializer.write(numSymbols);
+    for (auto i = 0u; i < numSymbols; i++) {
+        serializer.write(symbols[i]);
+        serializer.write(symbolLengths[i]);
+    }
+}
+
+FSSTMetadata FSSTMetadata::deserialize(common::Deserializer& deserializer) {
+    FSSTMetadata ret;
+    deserializer.deserializeValue(ret.numSymbols);
+    KU_ASSERT(ret.numSymbols <= MAX_NUM_SYMBOLS);
+    for (auto i = 0u; i < ret.numSymbols; i++) {
+        deserializer.deserializeValue(ret.symbols[i]);
+        deserializer.deserializeValue(ret.symbolLengths[i]);
+    }
+    return ret;
+}
+
+std::unique_ptr<ExtraMetadata> FSSTMetadata::copy() {
+    return std::make_unique<FSSTMetadata>(*this);
+}
+
 CompressionMetadata::CompressionMetadata(StorageValue min, StorageValue max,
     CompressionType compression, const alp::state& state, StorageValue minEncoded,
     StorageValue maxEncoded, common::PhysicalTypeID physicalType)
@@ -154,6 +177,8 @@ void CompressionMetadata::serialize(Serializer& serializer) const {
 
     if (compression == CompressionType::ALP) {
         floatMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::FSST) {
+        fsstMetadata()->serialize(serializer);
     }
 
     KU_ASSERT(children.size() == getChildCount(compression));
@@ -175,6 +200,9 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
     if (compressionType == CompressionType::ALP) {
         auto alpMetadata = std::make_unique<ALPMetadata>(ALPMetadata::deserialize(deserializer));
         ret.extraMetadata = std::move(alpMetadata);
+    } else if (compressionType == CompressionType::FSST) {
+        ret.extraMetadata =
+            std::make_unique<FSSTMetadata>(FSSTMetadata::deserialize(deserializer));
     }
 
     for (size_t i = 0; i < getChildCount(compressionType); ++i) {
@@ -187,7 +215,8 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
 bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     switch (compression) {
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::CONSTANT:
@@ -239,7 +268,8 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
         }
     }
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::ALP: {
@@ -296,7 +326,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return Uncompressed::numValues(pageSize, dataType);
     }
     case CompressionType::INTEGER_BITPACKING: {
@@ -437,6 +468,9 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
     case CompressionType::UNCOMPRESSED: {
         return "UNCOMPRESSED";
     }
+    case CompressionType::FSST: {
+        return stringFormat("FSST[{}]", fsstMetadata()->numSymbols);
+    }
     case CompressionType::ALP: {
         uint8_t bitWidth = TypeUtils::visit(
             physicalType,
@@ -886,6 +920,7 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -965,6 +1000,7 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
             numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -1045,6 +1081,7 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         return constant.setValuesFromUncompressed(data, dataOffset, frame, posInFrame, numValues,
             metadata, nullMask);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.setValuesFromUncompressed(data, dataOffset, frame, posInFrame,
             numValues, metadata, nullMask);
     case CompressionType::INTEGER_BITPACKING: {
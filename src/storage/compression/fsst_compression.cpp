@@ -0,0 +1,177 @@
+#include "storage/compression/fsst_compression.h"
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+namespace {
+
+struct Symbol {
+    uint64_t value;
+    uint8_t length;
+
+    bool operator==(const Symbol& other) const {
+        return value == other.value && length == other.length;
+    }
+    bool operator<(const Symbol& other) const {
+        return length == other.length ? value < other.value : length < other.length;
+    }
+
+    static Symbol fromBytes(const uint8_t* data, uint8_t length) {
+        Symbol symbol{0, length};
+        memcpy(&symbol.value, data, length);
+        return symbol;
+    }
+
+    static Symbol concat(const Symbol& left, const Symbol& right) {
+        KU_ASSERT(left.length + right.length <= FSSTMetadata::MAX_SYMBOL_LENGTH);
+        return Symbol{left.value | (right.value << (8 * left.length)),
+            static_cast<uint8_t>(left.length + right.length)};
+    }
+};
+
+struct SymbolHash {
+    std::size_t operator()(const Symbol& symbol) const {
+        return std::hash<uint64_t>()(symbol.value) ^
+               (static_cast<std::size_t>(symbol.length) << 59);
+    }
+};
+
+uint64_t getSymbolMask(uint8_t length) {
+    return length == FSSTMetadata::MAX_SYMBOL_LENGTH ? UINT64_MAX : (1ull << (8 * length)) - 1;
+}
+
+} // namespace
+
+// Number of rounds of the symbol table construction. Each round counts how often the symbols of
+// the current table, and pairs of adjacent symbols, occur in the encoded sample and keeps the
+// candidates that save the most bytes, so the longest symbols double in length every round.
+static constexpr uint64_t NUM_SYMBOL_TABLE_GENERATIONS = 5;
+
+FSSTMetadata FSSTCompression::buildSymbolTable(std::span<const std::string_view> sample) {
+    FSSTMetadata metadata;
+    for (auto generation = 0u; generation < NUM_SYMBOL_TABLE_GENERATIONS; generation++) {
+        const FSSTEncoder encoder{metadata};
+        std::unordered_map<Symbol, uint64_t, SymbolHash> counts;
+        for (const auto& str : sample) {
+            const auto data = reinterpret_cast<const uint8_t*>(str.data());
+            uint64_t pos = 0;
+            std::optional<Symbol> previous;
+            while (pos < str.size()) {
+                const auto code = encoder.findLongestSymbol(data + pos, str.size() - pos);
+                const auto symbol =
+                    code == FSSTMetadata::ESCAPE_CODE ?
+                        Symbol::fromBytes(data + pos, 1) :
+                        Symbol{metadata.symbols[code], metadata.symbolLengths[code]};
+                counts[symbol]++;
+                if (previous &&
+                    previous->length + symbol.length <= FSSTMetadata::MAX_SYMBOL_LENGTH) {
+                    counts[Symbol::concat(*previous, symbol)]++;
+                }
+                previous = symbol;
+                pos += symbol.length;
+            }
+        }
+        // A code saves (length - 1) bytes over the symbol's bytes each time it is used, and one
+        // more byte for single bytes, which would otherwise need an escape.
+        std::vector<std::pair<uint64_t, Symbol>> candidates;
+        candidates.reserve(counts.size());
+        for (const auto& [symbol, count] : counts) {
+            const auto gain = count * (symbol.length == 1 ? 1 : symbol.length - 1);
+            if (gain > 1) {
+                candidates.emplace_back(gain, symbol);
+            }
+        }
+        const auto numSymbols =
+            std::min<uint64_t>(candidates.size(), FSSTMetadata::MAX_NUM_SYMBOLS);
+        std::partial_sort(candidates.begin(), candidates.begin() + numSymbols, candidates.end(),
+            [](const auto& left, const auto& right) {
+                return left.first == right.first ? right.second < left.second :
+                                                   left.first > right.first;
+            });
+        metadata.numSymbols = numSymbols;
+        for (auto i = 0u; i < numSymbols; i++) {
+            metadata.symbols[i] = candidates[i].second.value;
+            metadata.symbolLengths[i] = candidates[i].second.length;
+        }
+    }
+    return metadata;
+}
+
+void FSSTCompression::decompress(const FSSTMetadata& metadata, const uint8_t* data, uint64_t size,
+    std::string& result) {
+    for (auto i = 0u; i < size; i++) {
+        const auto code = data[i];
+        if (code == FSSTMetadata::ESCAPE_CODE) {
+            KU_ASSERT(i + 1 < size);
+            result.push_back(static_cast<char>(data[++i]));
+        } else {
+            KU_ASSERT(code < metadata.numSymbols);
+            result.append(reinterpret_cast<const char*>(&metadata.symbols[code]),
+                metadata.symbolLengths[code]);
+        }
+    }
+}
+
+FSSTEncoder::FSSTEncoder(const FSSTMetadata& metadata) : metadata{metadata} {
+    for (auto code = 0u; code < metadata.numSymbols; code++) {
+        const auto firstByte = static_cast<uint8_t>(metadata.symbols[code]);
+        codesByFirstByte[firstByte].push_back(code);
+    }
+    for (auto& codes : codesByFirstByte) {
+        std::stable_sort(codes.begin(), codes.end(), [&](uint8_t left, uint8_t right) {
+            return metadata.symbolLengths[left] > metadata.symbolLengths[right];
+        });
+    }
+}
+
+uint8_t FSSTEncoder::findLongestSymbol(const uint8_t* str, uint64_t size) const {
+    KU_ASSERT(size > 0);
+    uint64_t word = 0;
+    memcpy(&word, str, std::min<uint64_t>(size, FSSTMetadata::MAX_SYMBOL_LENGTH));
+    for (const auto code : codesByFirstByte[str[0]]) {
+        const auto length = metadata.symbolLengths[code];
+        if (length <= size && (word & getSymbolMask(length)) == metadata.symbols[code]) {
+            return code;
+        }
+    }
+    return FSSTMetadata::ESCAPE_CODE;
+}
+
+void FSSTEncoder::compress(std::string_view str, std::vector<uint8_t>& result) const {
+    const auto data = reinterpret_cast<const uint8_t*>(str.data());
+    uint64_t pos = 0;
+    while (pos < str.size()) {
+        const auto code = findLongestSymbol(data + pos, str.size() - pos);
+        result.push_back(code);
+        if (code == FSSTMetadata::ESCAPE_CODE) {
+            result.push_back(data[pos++]);
+        } else {
+            pos += metadata.symbolLengths[code];
+        }
+    }
+}
+
+uint64_t FSSTEncoder::getCompressedSize(std::string_view str) const {
+    const auto data = reinterpret_cast<const uint8_t*>(str.data());
+    uint64_t pos = 0, compressedSize = 0;
+    while (pos < str.size()) {
+        const auto code = findLongestSymbol(data + pos, str.size() - pos);
+        if (code == FSSTMetadata::ESCAPE_CODE) {
+            compressedSize += 2;
+            pos++;
+        } else {
+            compressedSize++;
+            pos += metadata.symbolLengths[code];
+        }
+    }
+    return compressedSize;
+}
+
+} // namespace storage
+} // namespace kuzu
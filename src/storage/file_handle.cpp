@@ -1,6 +1,7 @@
 #include "storage/file_handle.h"
 
 #include <cmath>
+#include <vector>
 
 #include "common/file_system/virtual_file_system.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -93,17 +94,35 @@ uint8_t* FileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
 }
 
 void FileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageAccessHint accessHint) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, accessHint);
     }
 }
 
+bool FileHandle::optimisticReadPages(page_idx_t startPageIdx, page_idx_t numPagesToRead,
+    const std::function<void(uint8_t*)>& readOp, PageAccessHint accessHint) {
+    KU_ASSERT(startPageIdx + numPagesToRead <= numPages);
+    if (isInMemoryMode()) {
+        // Already pinned.
+        readOp(bm->getFrame(*this, startPageIdx));
+        return true;
+    }
+    return bm->optimisticReadPages(*this, startPageIdx, numPagesToRead, readOp, accessHint);
+}
+
+void FileHandle::prefetchPages(page_idx_t startPageIdx, page_idx_t numPagesToPrefetch) {
+    if (isInMemoryMode()) {
+        return;
+    }
+    bm->prefetchPages(*this, startPageIdx, numPagesToPrefetch);
+}
+
 void FileHandle::unpinPage(page_idx_t pageIdx) {
     bm->unpin(*this, pageIdx);
 }
@@ -145,8 +164,37 @@ void FileHandle::removePageFromFrameIfNecessary(page_idx_t pageIdx) {
 }
 
 void FileHandle::flushAllDirtyPagesInFrames() {
+    if (isInMemoryMode()) {
+        return;
+    }
+    // Dirty pages are handed to the file system in batches so that runs of adjacent pages are
+    // written together.
+    static constexpr uint64_t FLUSH_BATCH_NUM_PAGES = 256;
+    std::vector<FileIORequest> requests;
+    std::vector<page_idx_t> pagesInBatch;
+    requests.reserve(FLUSH_BATCH_NUM_PAGES);
+    pagesInBatch.reserve(FLUSH_BATCH_NUM_PAGES);
+    const auto flushBatch = [&]() {
+        fileInfo->writeFileBatch(requests);
+        for (const auto pageIdx : pagesInBatch) {
+            getPageState(pageIdx)->clearDirtyWithoutLock();
+        }
+        requests.clear();
+        pagesInBatch.clear();
+    };
     for (auto pageIdx = 0u; pageIdx < numPages; ++pageIdx) {
-        flushPageIfDirtyWithoutLock(pageIdx);
+        if (!getPageState(pageIdx)->isDirty()) {
+            continue;
+        }
+        requests.push_back(FileIORequest{getFrame(pageIdx), getPageSize(),
+            static_cast<uint64_t>(pageIdx) * getPageSize()});
+        pagesInBatch.push_back(pageIdx);
+        if (requests.size() == FLUSH_BATCH_NUM_PAGES) {
+            flushBatch();
+        }
+    }
+    if (!requests.empty()) {
+        flushBatch();
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "common/vector/value_vector.h"
 #include "storage/predicate/constant_predicate.h"
 
 using namespace kuzu::binder;
@@ -19,6 +20,15 @@ ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const ColumnChunkStats& stat
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+void ColumnPredicateSet::select(const ValueVector& vector, SelectionVector& selVector) const {
+    for (auto& predicate : predicates) {
+        if (selVector.getSelSize() == 0) {
+            return;
+        }
+        predicate->select(vector, selVector);
+    }
+}
+
 std::string ColumnPredicateSet::toString() const {
     if (predicates.empty()) {
         return {};
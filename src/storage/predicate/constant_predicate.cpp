@@ -1,6 +1,7 @@
 #include "storage/predicate/constant_predicate.h"
 
 #include "common/type_utils.h"
+#include "common/vector/value_vector.h"
 #include "function/comparison/comparison_functions.h"
 #include "storage/compression/compression.h"
 #include "storage/store/column_chunk_stats.h"
@@ -70,6 +71,63 @@ ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(const ColumnChunkStats&
         [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
 }
 
+template<typename T, typename OP>
+static void selectPositions(const ValueVector& vector, SelectionVector& selVector, T constant) {
+    const auto values = reinterpret_cast<const T*>(vector.getData());
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    const auto mayHaveNulls = !vector.hasNoNullsGuarantee();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (mayHaveNulls && vector.isNull(pos)) {
+            continue;
+        }
+        buffer[numSelected] = pos;
+        numSelected += OP::template operation<T>(values[pos], constant);
+    }
+    selVector.setToFiltered(numSelected);
+}
+
+template<typename T>
+static void selectSwitch(const ValueVector& vector, SelectionVector& selVector,
+    ExpressionType expressionType, const Value& value) {
+    const auto constant = value.getValue<T>();
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        selectPositions<T, Equals>(vector, selVector, constant);
+    } break;
+    case ExpressionType::NOT_EQUALS: {
+        selectPositions<T, NotEquals>(vector, selVector, constant);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        selectPositions<T, GreaterThan>(vector, selVector, constant);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        selectPositions<T, GreaterThanEquals>(vector, selVector, constant);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        selectPositions<T, LessThan>(vector, selVector, constant);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        selectPositions<T, LessThanEquals>(vector, selVector, constant);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void ColumnConstantPredicate::select(const ValueVector& vector, SelectionVector& selVector) const {
+    // The predicate may compare a cast of the column, in which case the stored values cannot be
+    // compared with the constant directly.
+    if (value.isNull() || vector.dataType != value.getDataType()) {
+        return;
+    }
+    TypeUtils::visit(
+        value.getDataType().getPhysicalType(),
+        [&]<StorageValueType T>(T) { selectSwitch<T>(vector, selVector, expressionType, value); },
+        [&](auto) {});
+}
+
 std::string ColumnConstantPredicate::toString() {
     std::string valStr;
     if (value.getDataType().getPhysicalType() == PhysicalTypeID::STRING ||
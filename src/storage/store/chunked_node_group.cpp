@@ -2,6 +2,7 @@
 
 #include "common/assert.h"
 #include "common/constants.h"
+#include "common/exception/runtime.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -237,24 +238,46 @@ void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState
         anchorSelVector.setToUnfiltered(numRowsToScan);
     }
 
-    if (anchorSelVector.getSelSize() > 0) {
-        for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
-            const auto columnID = scanState.columnIDs[i];
-            if (columnID == INVALID_COLUMN_ID) {
-                scanState.outputVectors[i]->setAllNull();
-                continue;
-            }
-            if (columnID == ROW_IDX_COLUMN_ID) {
-                for (auto rowIdx = 0u; rowIdx < numRowsToScan; rowIdx++) {
-                    scanState.rowIdxVector->setValue<row_idx_t>(rowIdx,
-                        rowIdx + rowIdxInGroup + startRowIdx);
-                }
-                continue;
+    if (anchorSelVector.getSelSize() == 0) {
+        return;
+    }
+    // Columns with pushed down predicates are scanned first and the predicates are evaluated on
+    // them, so that the remaining columns only read the pages holding qualifying rows.
+    std::vector<bool> isColumnScanned(scanState.columnIDs.size(), false);
+    for (auto i = 0u; i < scanState.columnPredicateSets.size(); i++) {
+        const auto columnID = scanState.columnIDs[i];
+        if (scanState.columnPredicateSets[i].isEmpty() || columnID == INVALID_COLUMN_ID ||
+            columnID == ROW_IDX_COLUMN_ID) {
+            continue;
+        }
+        KU_ASSERT(columnID < chunks.size());
+        chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
+            *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
+        isColumnScanned[i] = true;
+        scanState.columnPredicateSets[i].select(*scanState.outputVectors[i], anchorSelVector);
+        if (anchorSelVector.getSelSize() == 0) {
+            return;
+        }
+    }
+    for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
+        if (isColumnScanned[i]) {
+            continue;
+        }
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID) {
+            scanState.outputVectors[i]->setAllNull();
+            continue;
+        }
+        if (columnID == ROW_IDX_COLUMN_ID) {
+            for (auto rowIdx = 0u; rowIdx < numRowsToScan; rowIdx++) {
+                scanState.rowIdxVector->setValue<row_idx_t>(rowIdx,
+                    rowIdx + rowIdxInGroup + startRowIdx);
             }
-            KU_ASSERT(columnID < chunks.size());
-            chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
-                *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
+            continue;
         }
+        KU_ASSERT(columnID < chunks.size());
+        chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
+            *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
     }
 }
 
@@ -327,10 +350,23 @@ bool ChunkedNodeGroup::lookup(Transaction* transaction, const TableScanState& st
 
 void ChunkedNodeGroup::update(Transaction* transaction, row_idx_t rowIdxInChunk,
     column_id_t columnID, const ValueVector& propertyVector) {
+    if (transaction->getID() != Transaction::DUMMY_TRANSACTION_ID && versionInfo &&
+        versionInfo->isDeletedByConcurrentTransaction(transaction, rowIdxInChunk)) {
+        throw RuntimeException(
+            "Write-write conflict: updating a row that is deleted by another transaction.");
+    }
     getColumnChunk(columnID).update(transaction, rowIdxInChunk, propertyVector);
 }
 
 bool ChunkedNodeGroup::delete_(const Transaction* transaction, row_idx_t rowIdxInChunk) {
+    if (transaction->getID() != Transaction::DUMMY_TRANSACTION_ID) {
+        for (const auto& chunk : chunks) {
+            if (chunk->isUpdatedByConcurrentTransaction(transaction, rowIdxInChunk)) {
+                throw RuntimeException("Write-write conflict: deleting a row that is updated by "
+                                       "another transaction.");
+            }
+        }
+    }
     if (!versionInfo) {
         versionInfo = std::make_unique<VersionInfo>();
     }
@@ -379,6 +415,13 @@ row_idx_t ChunkedNodeGroup::getNumDeletions(const Transaction* transaction, row_
     return 0;
 }
 
+row_idx_t ChunkedNodeGroup::getNumVisibleRows(const Transaction* transaction) const {
+    if (versionInfo) {
+        return versionInfo->getNumVisibleRows(transaction, 0, numRows);
+    }
+    return numRows;
+}
+
 void ChunkedNodeGroup::finalize() const {
     for (auto i = 0u; i < chunks.size(); i++) {
         chunks[i]->getData().finalize();
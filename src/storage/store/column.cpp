@@ -241,9 +241,23 @@ void Column::scan(Transaction* transaction, const ChunkState& state, offset_t st
 
 void Column::scanInternal(Transaction* transaction, const ChunkState& state,
     offset_t startOffsetInChunk, row_idx_t numValuesToScan, ValueVector* resultVector) const {
-    if (resultVector->state->getSelVector().isUnfiltered()) {
+    // When only a few rows of the range survive the filters evaluated so far, the values are read
+    // one at a time instead of decompressing the pages holding them.
+    static constexpr uint64_t MIN_NUM_VALUES_PER_SELECTED_VALUE_FOR_LOOKUP = 32;
+    const auto& selVector = resultVector->state->getSelVector();
+    if (selVector.isUnfiltered()) {
         columnReadWriter->readCompressedValuesToVector(transaction, state, resultVector, 0,
             startOffsetInChunk, startOffsetInChunk + numValuesToScan, readToVectorFunc);
+    } else if (selVector.getSelSize() * MIN_NUM_VALUES_PER_SELECTED_VALUE_FOR_LOOKUP <=
+               numValuesToScan) {
+        for (auto i = 0u; i < selVector.getSelSize(); i++) {
+            const auto pos = selVector[i];
+            if (pos >= numValuesToScan || (nullColumn && resultVector->isNull(pos))) {
+                continue;
+            }
+            columnReadWriter->readCompressedValueToVector(transaction, state,
+                startOffsetInChunk + pos, resultVector, pos, readToVectorFunc);
+        }
     } else {
         struct Filterer {
             explicit Filterer(const SelectionVector& selVector)
@@ -263,7 +277,7 @@ void Column::scanInternal(Transaction* transaction, const ChunkState& state,
 
         columnReadWriter->readCompressedValuesToVector(transaction, state, resultVector, 0,
             startOffsetInChunk, startOffsetInChunk + numValuesToScan, readToVectorFunc,
-            Filterer{resultVector->state->getSelVector()});
+            Filterer{selVector});
     }
 }
 
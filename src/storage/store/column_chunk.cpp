@@ -1,6 +1,6 @@
 #include "storage/store/column_chunk.h"
 
-#include <algorithm>
+#include <array>
 
 #include "common/serializer/deserializer.h"
 #include "common/vector/value_vector.h"
@@ -65,18 +65,15 @@ void ColumnChunk::scan(const Transaction* transaction, const ChunkState& state,
         const auto startOffset = idx == startVectorIdx ? startOffsetInVector : 0;
         const auto endOffset = idx == endVectorIdx ? endOffsetInVector : DEFAULT_VECTOR_CAPACITY;
         const auto numRowsInVector = endOffset - startOffset;
-        if (const auto vectorInfo = updateInfo->getVectorInfo(transaction, idx);
-            vectorInfo && vectorInfo->numRowsUpdated > 0) {
-            for (auto i = 0u; i < numRowsInVector; i++) {
-                if (const auto itr = std::find_if(vectorInfo->rowsInVector.begin(),
-                        vectorInfo->rowsInVector.begin() + vectorInfo->numRowsUpdated,
-                        [i, startOffset](auto row) { return row == i + startOffset; });
-                    itr != vectorInfo->rowsInVector.begin() + vectorInfo->numRowsUpdated) {
-                    vectorInfo->data->lookup(itr - vectorInfo->rowsInVector.begin(), output,
-                        posInVector + i);
+        // Visit the updated rows rather than the scanned ones, as updates are usually sparse.
+        updateInfo->iterateVectorInfo(transaction, idx, [&](const VectorUpdateInfo& vectorInfo) {
+            for (auto i = 0u; i < vectorInfo.numRowsUpdated; i++) {
+                const auto row = vectorInfo.rowsInVector[i];
+                if (row >= startOffset && row < endOffset) {
+                    vectorInfo.data->lookup(i, output, posInVector + row - startOffset);
                 }
             }
-        }
+        });
         posInVector += numRowsInVector;
         idx++;
     }
@@ -121,6 +118,16 @@ bool ColumnChunk::hasUpdates(const Transaction* transaction, row_idx_t startRow,
     return updateInfo && updateInfo->hasUpdates(transaction, startRow, numRows);
 }
 
+bool ColumnChunk::isUpdatedByConcurrentTransaction(const Transaction* transaction,
+    row_idx_t rowInChunk) const {
+    if (!updateInfo) {
+        return false;
+    }
+    auto [vectorIdx, rowInVector] =
+        StorageUtils::getQuotientRemainder(rowInChunk, DEFAULT_VECTOR_CAPACITY);
+    return updateInfo->isUpdatedByConcurrentTransaction(transaction, vectorIdx, rowInVector);
+}
+
 void ColumnChunk::scanCommittedUpdates(const Transaction* transaction, ColumnChunkData& output,
     offset_t startOffsetInOutput, row_idx_t startRowScanned, row_idx_t numRows) const {
     if (!updateInfo) {
@@ -134,28 +141,18 @@ void ColumnChunk::scanCommittedUpdates(const Transaction* transaction, ColumnChu
     while (vectorIdx <= endVectorIdx) {
         const auto startRow = vectorIdx == startVectorIdx ? startRowInVector : 0;
         const auto endRow = vectorIdx == endVectorIdx ? endRowInVector : DEFAULT_VECTOR_CAPACITY;
-        // const auto numRowsInVector = endRow - startRow;
-        const auto vectorInfo = updateInfo->getVectorInfo(transaction, vectorIdx);
-        if (vectorInfo && vectorInfo->numRowsUpdated > 0) {
-            if (vectorIdx != startVectorIdx && vectorIdx != endVectorIdx) {
-                for (auto i = 0u; i < vectorInfo->numRowsUpdated; i++) {
-                    output.write(vectorInfo->data.get(), i,
-                        startOffsetInOutput + vectorIdx * DEFAULT_VECTOR_CAPACITY +
-                            vectorInfo->rowsInVector[i] - startRowScanned,
-                        1);
-                }
-            } else {
-                for (auto i = 0u; i < vectorInfo->numRowsUpdated; i++) {
-                    const auto rowInVecUpdated = vectorInfo->rowsInVector[i];
+        updateInfo->iterateVectorInfo(transaction, vectorIdx,
+            [&](const VectorUpdateInfo& vectorInfo) {
+                for (auto i = 0u; i < vectorInfo.numRowsUpdated; i++) {
+                    const auto rowInVecUpdated = vectorInfo.rowsInVector[i];
                     if (rowInVecUpdated >= startRow && rowInVecUpdated < endRow) {
-                        output.write(vectorInfo->data.get(), i,
+                        output.write(vectorInfo.data.get(), i,
                             startOffsetInOutput + vectorIdx * DEFAULT_VECTOR_CAPACITY +
                                 rowInVecUpdated - startRowScanned,
                             1);
                     }
                 }
-            }
-        }
+            });
         vectorIdx++;
     }
 }
@@ -173,14 +170,12 @@ void ColumnChunk::lookup(Transaction* transaction, const ChunkState& state, offs
     if (updateInfo) {
         auto [vectorIdx, rowInVector] =
             StorageUtils::getQuotientRemainder(rowInChunk, DEFAULT_VECTOR_CAPACITY);
-        if (const auto vectorInfo = updateInfo->getVectorInfo(transaction, vectorIdx)) {
-            for (auto i = 0u; i < vectorInfo->numRowsUpdated; i++) {
-                if (vectorInfo->rowsInVector[i] == rowInVector) {
-                    vectorInfo->data->lookup(i, output, posInOutputVector);
-                    return;
+        updateInfo->iterateVectorInfo(transaction, vectorIdx,
+            [&](const VectorUpdateInfo& vectorInfo) {
+                if (const auto idx = vectorInfo.findRow(rowInVector); idx != INVALID_IDX) {
+                    vectorInfo.data->lookup(idx, output, posInOutputVector);
                 }
-            }
-        }
+            });
     }
 }
 
@@ -232,17 +227,23 @@ std::pair<std::unique_ptr<ColumnChunk>, std::unique_ptr<ColumnChunk>> ColumnChun
         ResidencyState::IN_MEMORY);
     const auto numUpdateVectors = updateInfo->getNumVectors();
     row_idx_t numAppendedRows = 0;
+    // A row updated in more than one version is output once, with its newest value.
+    std::array<row_idx_t, DEFAULT_VECTOR_CAPACITY> posInOutput{};
     for (auto vectorIdx = 0u; vectorIdx < numUpdateVectors; vectorIdx++) {
-        const auto vectorInfo = updateInfo->getVectorInfo(transaction, vectorIdx);
-        if (!vectorInfo) {
-            continue;
-        }
         const row_idx_t startRowIdx = vectorIdx * DEFAULT_VECTOR_CAPACITY;
-        for (auto rowIdx = 0u; rowIdx < vectorInfo->numRowsUpdated; rowIdx++) {
-            updatedRows->getData().setValue<row_idx_t>(
-                vectorInfo->rowsInVector[rowIdx] + startRowIdx, numAppendedRows++);
-        }
-        updatedData->getData().append(vectorInfo->data.get(), 0, vectorInfo->numRowsUpdated);
+        posInOutput.fill(INVALID_ROW_IDX);
+        updateInfo->iterateVectorInfo(transaction, vectorIdx,
+            [&](const VectorUpdateInfo& vectorInfo) {
+                for (auto i = 0u; i < vectorInfo.numRowsUpdated; i++) {
+                    const auto row = vectorInfo.rowsInVector[i];
+                    if (posInOutput[row] == INVALID_ROW_IDX) {
+                        posInOutput[row] = numAppendedRows++;
+                        updatedRows->getData().setValue<row_idx_t>(row + startRowIdx,
+                            posInOutput[row]);
+                    }
+                    updatedData->getData().write(vectorInfo.data.get(), i, posInOutput[row], 1);
+                }
+            });
         KU_ASSERT(updatedData->getData().getNumValues() == updatedRows->getData().getNumValues());
     }
     return {std::move(updatedRows), std::move(updatedData)};
@@ -178,20 +178,31 @@ public:
             state.numValuesPerPage);
         KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
 
+        const auto accessHint = getAccessHintForRangeRead(chunkMeta);
         uint64_t numValuesScanned = 0;
         while (numValuesScanned < numValuesToScan) {
+            if (!filterFunc.has_value()) {
+                const auto numValuesReadFromExtent = readCompressedValuesFromExtent(transaction,
+                    state, pageCursor, result, numValuesScanned + startOffsetInResult,
+                    numValuesToScan - numValuesScanned, readFunc, accessHint);
+                if (numValuesReadFromExtent > 0) {
+                    numValuesScanned += numValuesReadFromExtent;
+                    continue;
+                }
+            }
             uint64_t numValuesToScanInPage =
                 std::min(state.numValuesPerPage - pageCursor.elemPosInPage,
                     numValuesToScan - numValuesScanned);
             KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
             if (!filterFunc.has_value() ||
                 filterFunc.value()(numValuesScanned, numValuesScanned + numValuesToScanInPage)) {
-
+                readAheadIfNotCached(transaction, chunkMeta, pageCursor.pageIdx);
                 const auto readFromPageFunc = [&](uint8_t* frame) -> void {
                     readFunc(frame, pageCursor, result, numValuesScanned + startOffsetInResult,
                         numValuesToScanInPage, chunkMeta.compMeta);
                 };
-                readFromPage(transaction, pageCursor.pageIdx, std::cref(readFromPageFunc));
+                readFromPage(transaction, pageCursor.pageIdx, std::cref(readFromPageFunc),
+                    accessHint);
             }
             numValuesScanned += numValuesToScanInPage;
             pageCursor.nextPage();
@@ -199,6 +210,54 @@ public:
 
         return numValuesScanned;
     }
+
+    // Reads the values in the pages starting at pageCursor with a single optimistic read, as long
+    // as the pages are cached and their frames are contiguous (i.e. in the same page group).
+    // On success, returns the number of values read and advances pageCursor past the pages read.
+    // Returns 0 if the values have to be read page by page instead.
+    template<typename OutputType>
+    uint64_t readCompressedValuesFromExtent(Transaction* transaction, const ChunkState& state,
+        PageCursor& pageCursor, OutputType result, uint32_t offsetInResult,
+        uint64_t numValuesToRead,
+        const read_values_from_page_func_t<OutputType>& readFunc, PageAccessHint accessHint) {
+        if (pageCursor.pageIdx == INVALID_PAGE_IDX) {
+            return 0;
+        }
+        const auto numValuesFromPageStart = pageCursor.elemPosInPage + numValuesToRead;
+        const auto numPagesToEnd = numValuesFromPageStart / state.numValuesPerPage +
+                                   (numValuesFromPageStart % state.numValuesPerPage != 0);
+        const auto numPagesLeftInGroup =
+            StorageConstants::PAGE_GROUP_SIZE -
+            (pageCursor.pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK);
+        const auto numPages = std::min<uint64_t>(
+            {numPagesToEnd, BufferManager::MAX_NUM_PAGES_PER_EXTENT_READ, numPagesLeftInGroup});
+        if (numPages < 2) {
+            return 0;
+        }
+        readAheadIfNotCached(transaction, state.metadata, pageCursor.pageIdx);
+        PageCursor cursor;
+        uint64_t numValuesRead = 0;
+        const auto readFromExtentFunc = [&](uint8_t* frame) -> void {
+            // The read may be retried, so restart from the initial cursor.
+            cursor = pageCursor;
+            numValuesRead = 0;
+            for (auto i = 0u; i < numPages; i++) {
+                const auto numValuesToReadInPage = std::min(
+                    state.numValuesPerPage - cursor.elemPosInPage, numValuesToRead - numValuesRead);
+                readFunc(frame + i * KUZU_PAGE_SIZE, cursor, result,
+                    offsetInResult + numValuesRead, numValuesToReadInPage,
+                    state.metadata.compMeta);
+                numValuesRead += numValuesToReadInPage;
+                cursor.nextPage();
+            }
+        };
+        if (!readFromPages(transaction, pageCursor.pageIdx, numPages,
+                std::cref(readFromExtentFunc), accessHint)) {
+            return 0;
+        }
+        pageCursor = cursor;
+        return numValuesRead;
+    }
 };
 
 template<std::floating_point T>
@@ -430,7 +489,7 @@ ColumnReadWriter::ColumnReadWriter(DBFileID dbFileID, FileHandle* dataFH,
     : dbFileID(dbFileID), dataFH(dataFH), bufferManager(bufferManager), shadowFile(shadowFile) {}
 
 void ColumnReadWriter::readFromPage(Transaction* transaction, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readFunc) {
+    const std::function<void(uint8_t*)>& readFunc, PageAccessHint accessHint) {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
@@ -438,7 +497,40 @@ void ColumnReadWriter::readFromPage(Transaction* transaction, page_idx_t pageIdx
     }
     auto [fileHandleToPin, pageIdxToPin] = ShadowUtils::getFileHandleAndPhysicalPageIdxToPin(
         *dataFH, pageIdx, *shadowFile, transaction->getType());
-    fileHandleToPin->optimisticReadPage(pageIdxToPin, readFunc);
+    fileHandleToPin->optimisticReadPage(pageIdxToPin, readFunc, accessHint);
+}
+
+bool ColumnReadWriter::readFromPages(Transaction* transaction, page_idx_t startPageIdx,
+    page_idx_t numPages, const std::function<void(uint8_t*)>& readFunc,
+    PageAccessHint accessHint) {
+    // Checkpointing transactions may have to read some of the pages from the shadow file.
+    if (transaction->getType() == TransactionType::CHECKPOINT) {
+        return false;
+    }
+    return dataFH->optimisticReadPages(startPageIdx, numPages, readFunc, accessHint);
+}
+
+PageAccessHint ColumnReadWriter::getAccessHintForRangeRead(const ColumnChunkMetadata& metadata) {
+    // Small chunks, such as CSR headers, are read as ranges by point lookups too, so only range
+    // reads on large chunks are treated as scans.
+    return metadata.numPages > READ_AHEAD_NUM_PAGES ? PageAccessHint::SCAN :
+                                                      PageAccessHint::DEFAULT;
+}
+
+void ColumnReadWriter::readAheadIfNotCached(Transaction* transaction,
+    const ColumnChunkMetadata& metadata, page_idx_t pageIdx) {
+    // Checkpointing transactions may read shadow pages instead of the pages of the data file.
+    if (pageIdx == INVALID_PAGE_IDX || pageIdx >= dataFH->getNumPages() ||
+        transaction->getType() == TransactionType::CHECKPOINT) {
+        return;
+    }
+    if (PageState::getState(dataFH->getPageState(pageIdx)->getStateAndVersion()) !=
+        PageState::EVICTED) {
+        return;
+    }
+    const auto endPageIdx =
+        std::min<page_idx_t>(pageIdx + READ_AHEAD_NUM_PAGES, metadata.pageIdx + metadata.numPages);
+    dataFH->prefetchPages(pageIdx, endPageIdx - pageIdx);
 }
 
 void ColumnReadWriter::updatePageWithCursor(PageCursor cursor,
@@ -49,6 +49,96 @@ bool CSRNodeGroupScanState::tryScanCachedTuples(RelTableScanState& tableScanStat
     return true;
 }
 
+void CSRIndex::appendRows(offset_t offset, row_idx_t startRow, length_t length) {
+    KU_ASSERT(length > 0);
+    auto& region = regions[getRegionIdx(offset)];
+    if (!region) {
+        region = std::make_unique<Region>();
+    }
+    const auto offsetInRegion = getOffsetInRegion(offset);
+    auto& list = region->lists[offsetInRegion];
+    if (list.length == 0) {
+        list.startRow = startRow;
+        list.length = length;
+        return;
+    }
+    if (list.startRow != INVALID_ROW_IDX) {
+        if (list.startRow + list.length == startRow) {
+            // Appending to the end of a sequential csr list keeps it sequential.
+            list.length += length;
+            return;
+        }
+        // Expand rows of the list.
+        auto& rows = region->nonSequentialRows[offsetInRegion];
+        KU_ASSERT(rows.empty());
+        rows.reserve(list.length + length);
+        for (auto i = 0u; i < list.length; i++) {
+            rows.push_back(list.startRow + i);
+        }
+        list.startRow = INVALID_ROW_IDX;
+    }
+    auto& rows = region->nonSequentialRows.at(offsetInRegion);
+    const auto needSort = !rows.empty() && rows.back() > startRow;
+    for (auto i = 0u; i < length; i++) {
+        rows.push_back(startRow + i);
+    }
+    if (needSort) {
+        std::sort(rows.begin(), rows.end());
+    }
+    list.length = rows.size();
+}
+
+void CSRIndex::setInvalid(offset_t offset, idx_t idx) {
+    const auto& region = regions[getRegionIdx(offset)];
+    KU_ASSERT(region);
+    const auto offsetInRegion = getOffsetInRegion(offset);
+    auto& list = region->lists[offsetInRegion];
+    KU_ASSERT(idx < list.length);
+    if (list.startRow != INVALID_ROW_IDX) {
+        auto& rows = region->nonSequentialRows[offsetInRegion];
+        rows.reserve(list.length);
+        for (auto i = 0u; i < list.length; i++) {
+            rows.push_back(list.startRow + i);
+        }
+        list.startRow = INVALID_ROW_IDX;
+    }
+    region->nonSequentialRows.at(offsetInRegion)[idx] = INVALID_ROW_IDX;
+}
+
+offset_t CSRIndex::getMaxOffsetWithRels() const {
+    for (auto regionIdx = NUM_REGIONS; regionIdx > 0; regionIdx--) {
+        const auto& region = regions[regionIdx - 1];
+        if (!region) {
+            continue;
+        }
+        for (auto offsetInRegion = StorageConstants::CSR_LEAF_REGION_SIZE; offsetInRegion > 0;
+             offsetInRegion--) {
+            if (region->lists[offsetInRegion - 1].length > 0) {
+                return ((regionIdx - 1) << StorageConstants::CSR_LEAF_REGION_SIZE_LOG2) +
+                       offsetInRegion - 1;
+            }
+        }
+    }
+    return 0;
+}
+
+NodeCSRIndex CSRIndex::getNodeCSRIndex(offset_t offset) const {
+    NodeCSRIndex nodeCSRIndex;
+    const auto region = getRegion(offset);
+    if (!region) {
+        return nodeCSRIndex;
+    }
+    const auto offsetInRegion = getOffsetInRegion(offset);
+    const auto& list = region->lists[offsetInRegion];
+    if (list.startRow != INVALID_ROW_IDX) {
+        nodeCSRIndex.isSequential = true;
+        nodeCSRIndex.sequentialRows = list;
+    } else if (list.length > 0) {
+        nodeCSRIndex.rowIndices = region->nonSequentialRows.at(offsetInRegion);
+    }
+    return nodeCSRIndex;
+}
+
 void CSRNodeGroup::initializeScanState(Transaction* transaction, TableScanState& state) const {
     auto& relScanState = state.cast<RelTableScanState>();
     KU_ASSERT(relScanState.nodeGroupScanState);
@@ -64,9 +154,9 @@ void CSRNodeGroup::initializeScanState(Transaction* transaction, TableScanState&
     if (persistentChunkGroup) {
         nodeGroupScanState.numScannedRows = 0;
         nodeGroupScanState.numCachedRows = 0;
-        nodeGroupScanState.nextRowToScan = 0;
+        nodeGroupScanState.nextRowToScan = relScanState.persistentStartRow;
         nodeGroupScanState.source = CSRNodeGroupScanSource::COMMITTED_PERSISTENT;
-    } else if (csrIndex) {
+    } else if (csrIndex && relScanState.scanNonPersistentRows()) {
         initScanForCommittedInMem(relScanState, nodeGroupScanState);
     } else {
         nodeGroupScanState.source = CSRNodeGroupScanSource::NONE;
@@ -119,7 +209,8 @@ NodeGroupScanResult CSRNodeGroup::scan(Transaction* transaction, TableScanState&
         switch (nodeGroupScanState.source) {
         case CSRNodeGroupScanSource::COMMITTED_PERSISTENT: {
             auto result = scanCommittedPersistent(transaction, relScanState, nodeGroupScanState);
-            if (result == NODE_GROUP_SCAN_EMMPTY_RESULT && csrIndex) {
+            if (result == NODE_GROUP_SCAN_EMMPTY_RESULT && csrIndex &&
+                relScanState.scanNonPersistentRows()) {
                 initScanForCommittedInMem(relScanState, nodeGroupScanState);
                 continue;
             }
@@ -151,6 +242,8 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedPersistent(const Transaction* tra
         // Note that we don't apply cache when there is only one bound node.
         return scanCommittedPersistentWtihoutCache(transaction, tableState, nodeGroupScanState);
     }
+    // Row ranges are only supported when scanning the csr list of a single bound node.
+    KU_ASSERT(tableState.persistentStartRow == 0 && tableState.persistentEndRow == INVALID_ROW_IDX);
     return scanCommittedPersistentWithCache(transaction, tableState, nodeGroupScanState);
 }
 
@@ -201,8 +294,9 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedPersistentWtihoutCache(
     const auto currNodeOffset = tableState.nodeIDVector->readNodeOffset(
         tableState.cachedBoundNodeSelVector[tableState.currBoundNodeIdx]);
     const auto offsetInGroup = currNodeOffset % StorageConstants::NODE_GROUP_SIZE;
-    const auto csrListLength = nodeGroupScanState.header->getCSRLength(offsetInGroup);
-    if (nodeGroupScanState.nextRowToScan == csrListLength) {
+    const auto csrListLength = std::min(nodeGroupScanState.header->getCSRLength(offsetInGroup),
+        tableState.persistentEndRow);
+    if (nodeGroupScanState.nextRowToScan >= csrListLength) {
         return NODE_GROUP_SCAN_EMMPTY_RESULT;
     }
     const auto startRow = nodeGroupScanState.header->getStartCSROffset(offsetInGroup) +
@@ -222,12 +316,12 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedInMem(Transaction* transaction,
         if (tableState.currBoundNodeIdx >= tableState.cachedBoundNodeSelVector.getSelSize()) {
             return NODE_GROUP_SCAN_EMMPTY_RESULT;
         }
-        if (nodeGroupScanState.inMemCSRList.rowIndices.empty()) {
+        if (nodeGroupScanState.inMemCSRList.isEmpty()) {
             const auto boundNodePos =
                 tableState.cachedBoundNodeSelVector[tableState.currBoundNodeIdx];
             const auto boundNodeOffset = tableState.nodeIDVector->readNodeOffset(boundNodePos);
             const auto offsetInGroup = boundNodeOffset % StorageConstants::NODE_GROUP_SIZE;
-            nodeGroupScanState.inMemCSRList = csrIndex->indices[offsetInGroup];
+            nodeGroupScanState.inMemCSRList = csrIndex->getNodeCSRIndex(offsetInGroup);
         }
         if (!nodeGroupScanState.inMemCSRList.isSequential) {
             KU_ASSERT(std::is_sorted(nodeGroupScanState.inMemCSRList.rowIndices.begin(),
@@ -251,11 +345,10 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedInMem(Transaction* transaction,
 
 NodeGroupScanResult CSRNodeGroup::scanCommittedInMemSequential(const Transaction* transaction,
     const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const {
-    const auto startRow =
-        nodeGroupScanState.inMemCSRList.rowIndices[0] + nodeGroupScanState.nextRowToScan;
+    const auto& csrList = nodeGroupScanState.inMemCSRList.sequentialRows;
+    const auto startRow = csrList.startRow + nodeGroupScanState.nextRowToScan;
     auto numRows =
-        std::min(nodeGroupScanState.inMemCSRList.rowIndices[1] - nodeGroupScanState.nextRowToScan,
-            DEFAULT_VECTOR_CAPACITY);
+        std::min(csrList.length - nodeGroupScanState.nextRowToScan, DEFAULT_VECTOR_CAPACITY);
     auto [chunkIdx, startRowInChunk] =
         StorageUtils::getQuotientRemainder(startRow, ChunkedNodeGroup::CHUNK_CAPACITY);
     numRows = std::min(numRows, ChunkedNodeGroup::CHUNK_CAPACITY - startRowInChunk);
@@ -318,7 +411,9 @@ void CSRNodeGroup::appendChunkedCSRGroup(const Transaction* transaction,
     }
     for (auto i = 0u; i < csrHeader.offset->getNumValues(); i++) {
         const auto length = csrHeader.length->getData().getValue<length_t>(i);
-        updateCSRIndex(i, startRow, length);
+        if (length > 0) {
+            csrIndex->appendRows(i, startRow, length);
+        }
         startRow += length;
     }
 }
@@ -329,44 +424,7 @@ void CSRNodeGroup::append(const Transaction* transaction, offset_t boundOffsetIn
     if (!csrIndex) {
         csrIndex = std::make_unique<CSRIndex>();
     }
-    updateCSRIndex(boundOffsetInGroup, startRow, 1 /*length*/);
-}
-
-void CSRNodeGroup::updateCSRIndex(offset_t boundNodeOffsetInGroup, row_idx_t startRow,
-    length_t length) const {
-    auto& nodeCSRIndex = csrIndex->indices[boundNodeOffsetInGroup];
-    const auto isEmptyCSR = nodeCSRIndex.rowIndices.empty();
-    const auto appendToEndOfCSR =
-        !isEmptyCSR && nodeCSRIndex.isSequential &&
-        (nodeCSRIndex.rowIndices[0] + nodeCSRIndex.rowIndices[1] == startRow);
-    const bool sequential = isEmptyCSR || appendToEndOfCSR;
-    if (nodeCSRIndex.isSequential && !sequential) {
-        // Expand rowIndices for the node.
-        const auto csrListStartRow = nodeCSRIndex.rowIndices[0];
-        const auto csrListLength = nodeCSRIndex.rowIndices[1];
-        nodeCSRIndex.rowIndices.clear();
-        nodeCSRIndex.rowIndices.reserve(csrListLength + length);
-        for (auto j = 0u; j < csrListLength; j++) {
-            nodeCSRIndex.rowIndices.push_back(csrListStartRow + j);
-        }
-    }
-    if (sequential) {
-        nodeCSRIndex.isSequential = true;
-        if (!nodeCSRIndex.rowIndices.empty()) {
-            KU_ASSERT(appendToEndOfCSR);
-            nodeCSRIndex.rowIndices[1] += length;
-        } else {
-            nodeCSRIndex.rowIndices.resize(2);
-            nodeCSRIndex.rowIndices[0] = startRow;
-            nodeCSRIndex.rowIndices[1] = length;
-        }
-    } else {
-        nodeCSRIndex.isSequential = false;
-        for (auto j = 0u; j < length; j++) {
-            nodeCSRIndex.rowIndices.push_back(startRow + j);
-        }
-        std::sort(nodeCSRIndex.rowIndices.begin(), nodeCSRIndex.rowIndices.end());
-    }
+    csrIndex->appendRows(boundOffsetInGroup, startRow, 1 /*length*/);
 }
 
 void CSRNodeGroup::update(Transaction* transaction, CSRNodeGroupScanSource source,
@@ -589,12 +647,11 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
         }
         // Merge in-memory insertions into the new chunk.
         if (csrIndex) {
-            auto rows = csrIndex->indices[nodeOffset].getRows();
             // TODO(Guodong): Optimize here. if no deletions and has sequential rows, scan in
             // range.
-            for (const auto row : rows) {
+            csrIndex->forEachRow(nodeOffset, [&](idx_t, row_idx_t row) {
                 if (row == INVALID_ROW_IDX) {
-                    continue;
+                    return;
                 }
                 auto [chunkIdx, rowInChunk] =
                     StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
@@ -602,7 +659,7 @@ ChunkCheckpointState CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock
                 KU_ASSERT(!chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk));
                 chunkedGroup->getColumnChunk(columnID).scanCommitted<ResidencyState::IN_MEMORY>(
                     &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *newChunk, rowInChunk, 1);
-            }
+            });
         }
         // Fill gaps if any.
         int64_t numGaps = csrState.newHeader->getGapSize(nodeOffset);
@@ -652,20 +709,8 @@ void CSRNodeGroup::collectInMemRegionChangesAndUpdateHeaderLength(const UniqLock
     if (csrIndex) {
         for (auto nodeOffset = region.leftNodeOffset; nodeOffset <= region.rightNodeOffset;
              nodeOffset++) {
-            auto rows = csrIndex->indices[nodeOffset].getRows();
-            row_idx_t numInsertedRows = rows.size();
-            row_idx_t numInMemDeletionsInCSR = 0;
-            for (auto i = 0u; i < rows.size(); i++) {
-                const auto row = rows[i];
-                auto [chunkIdx, rowInChunk] =
-                    StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
-                const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
-                if (chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk)) {
-                    csrIndex->indices[nodeOffset].turnToNonSequential();
-                    csrIndex->indices[nodeOffset].setInvalid(i);
-                    numInMemDeletionsInCSR++;
-                }
-            }
+            row_idx_t numInsertedRows = csrIndex->getNumRows(nodeOffset);
+            const auto numInMemDeletionsInCSR = invalidateDeletedRows(lock, nodeOffset);
             KU_ASSERT(numInMemDeletionsInCSR <= numInsertedRows);
             numInsertedRows -= numInMemDeletionsInCSR;
             const auto oldLength = csrState.oldHeader->getCSRLength(nodeOffset);
@@ -778,32 +823,29 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     }
 
     // Scan tuples from in mem node groups and append to data chunks to flush.
+    sel_t numRowsToAppend = 0;
+    const auto appendRowsToFlush = [&]() {
+        scanChunk.state->getSelVectorUnsafe().setSelSize(numRowsToAppend);
+        lookup(lock, &DUMMY_CHECKPOINT_TRANSACTION, *scanState);
+        for (auto idx = 0u; idx < numColumnsToCheckpoint; idx++) {
+            dataChunksToFlush[idx]->getData().append(scanChunk.valueVectors[idx].get(),
+                scanChunk.state->getSelVector());
+        }
+        numRowsToAppend = 0;
+    };
     for (auto offset = 0u; offset < numNodes; offset++) {
-        const auto numRows = csrIndex->getNumRows(offset);
-        auto rows = csrIndex->indices[offset].getRows();
-        auto numRowsTryAppended = 0u;
-        while (numRowsTryAppended < numRows) {
-            const auto maxNumRowsToAppend =
-                std::min(numRows - numRowsTryAppended, DEFAULT_VECTOR_CAPACITY);
-            auto numRowsToAppend = 0u;
-            for (auto i = 0u; i < maxNumRowsToAppend; i++) {
-                const auto row = rows[numRowsTryAppended + i];
-                // TODO(Guodong): Should skip deleted rows here.
-                if (row == INVALID_ROW_IDX) {
-                    continue;
-                }
-                numRowsToAppend++;
-                scanState->rowIdxVector->setValue<row_idx_t>(i, row);
+        csrIndex->forEachRow(offset, [&](idx_t, row_idx_t row) {
+            // Deleted rows have been invalidated in populateCSRLengthInMemOnly.
+            if (row == INVALID_ROW_IDX) {
+                return;
             }
-            scanChunk.state->getSelVectorUnsafe().setSelSize(numRowsToAppend);
-            if (numRowsToAppend > 0) {
-                lookup(lock, &DUMMY_CHECKPOINT_TRANSACTION, *scanState);
-                for (auto idx = 0u; idx < numColumnsToCheckpoint; idx++) {
-                    dataChunksToFlush[idx]->getData().append(scanChunk.valueVectors[idx].get(),
-                        scanChunk.state->getSelVector());
-                }
+            scanState->rowIdxVector->setValue<row_idx_t>(numRowsToAppend++, row);
+            if (numRowsToAppend == DEFAULT_VECTOR_CAPACITY) {
+                appendRowsToFlush();
             }
-            numRowsTryAppended += maxNumRowsToAppend;
+        });
+        if (numRowsToAppend > 0) {
+            appendRowsToFlush();
         }
         auto gapSize = csrState.newHeader->getGapSize(offset);
         while (gapSize > 0) {
@@ -846,26 +888,32 @@ void CSRNodeGroup::initScanStateFromScanChunk(const CSRNodeGroupCheckpointState&
     }
 }
 
+row_idx_t CSRNodeGroup::invalidateDeletedRows(const UniqLock& lock, offset_t nodeOffset) const {
+    std::vector<idx_t> deletedIdxes;
+    csrIndex->forEachRow(nodeOffset, [&](idx_t idx, row_idx_t row) {
+        if (row == INVALID_ROW_IDX) {
+            return;
+        }
+        auto [chunkIdx, rowInChunk] =
+            StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
+        const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
+        if (chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk)) {
+            deletedIdxes.push_back(idx);
+        }
+    });
+    for (const auto idx : deletedIdxes) {
+        csrIndex->setInvalid(nodeOffset, idx);
+    }
+    return deletedIdxes.size();
+}
+
 void CSRNodeGroup::populateCSRLengthInMemOnly(const UniqLock& lock, offset_t numNodes,
     const CSRNodeGroupCheckpointState& csrState) {
     for (auto offset = 0u; offset < numNodes; offset++) {
-        auto rows = csrIndex->indices[offset].getRows();
-        const length_t length = rows.size();
-        auto lengthAfterDelete = length;
-        for (auto i = 0u; i < rows.size(); i++) {
-            const auto row = rows[i];
-            auto [chunkIdx, rowInChunk] =
-                StorageUtils::getQuotientRemainder(row, ChunkedNodeGroup::CHUNK_CAPACITY);
-            const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
-            const auto isDeleted =
-                chunkedGroup->isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, rowInChunk);
-            if (isDeleted) {
-                csrIndex->indices[offset].turnToNonSequential();
-                csrIndex->indices[offset].setInvalid(i);
-                lengthAfterDelete--;
-            }
-        }
-        KU_ASSERT(lengthAfterDelete <= length);
+        const length_t length = csrIndex->getNumRows(offset);
+        const auto numDeletions = invalidateDeletedRows(lock, offset);
+        KU_ASSERT(numDeletions <= length);
+        const auto lengthAfterDelete = length - numDeletions;
         csrState.newHeader->length->getData().setValue<length_t>(lengthAfterDelete, offset);
     }
 }
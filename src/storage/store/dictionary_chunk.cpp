@@ -3,6 +3,7 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst_compression.h"
 #include "storage/enums/residency_state.h"
 #include <bit>
 
@@ -100,8 +101,99 @@ uint64_t DictionaryChunk::getEstimatedMemoryUsage() const {
 }
 
 void DictionaryChunk::flush(FileHandle& dataFH) {
+    auto compressedData = compressStringData();
+    if (compressedData) {
+        // The dictionary is on disk after flushing, so the encoded strings can replace the raw
+        // ones.
+        stringDataChunk = std::move(compressedData->stringDataChunk);
+        offsetChunk = std::move(compressedData->offsetChunk);
+        indexTable.clear();
+    }
     stringDataChunk->flush(dataFH);
     offsetChunk->flush(dataFH);
+    if (compressedData) {
+        setFSSTMetadata(*stringDataChunk, compressedData->metadata);
+    }
+}
+
+// Number of bytes of strings used to build the symbol table and estimate the compression ratio.
+static constexpr uint64_t FSST_SAMPLE_SIZE = 16 * 1024;
+// String data is only compressed if the sample shrinks to at most this fraction of its size.
+static constexpr double FSST_MAX_COMPRESSION_RATIO = 0.8;
+
+std::optional<DictionaryChunk::CompressedStringData> DictionaryChunk::compressStringData() const {
+    const auto dataSize = stringDataChunk->getNumValues();
+    const auto numStrings = offsetChunk->getNumValues();
+    // Data smaller than a page cannot take up fewer pages.
+    if (!enableCompression || dataSize < KUZU_PAGE_SIZE) {
+        return std::nullopt;
+    }
+    std::vector<std::string_view> sample;
+    uint64_t sampleSize = 0;
+    const auto stride = std::max<uint64_t>(1, dataSize / FSST_SAMPLE_SIZE);
+    for (auto i = 0u; i < numStrings && sampleSize < FSST_SAMPLE_SIZE; i += stride) {
+        sample.push_back(getString(i));
+        sampleSize += sample.back().size();
+    }
+    auto metadata = FSSTCompression::buildSymbolTable(sample);
+    const FSSTEncoder encoder{metadata};
+    uint64_t compressedSampleSize = 0;
+    for (const auto& str : sample) {
+        compressedSampleSize += encoder.getCompressedSize(str);
+    }
+    if (compressedSampleSize > sampleSize * FSST_MAX_COMPRESSION_RATIO) {
+        return std::nullopt;
+    }
+
+    auto& mm = stringDataChunk->getMemoryManager();
+    auto compressedOffsetChunk = ColumnChunkFactory::createColumnChunkData(mm,
+        LogicalType::UINT64(), enableCompression, numStrings, ResidencyState::IN_MEMORY,
+        false /*hasNullData*/);
+    std::vector<uint8_t> compressedData;
+    compressedData.reserve(dataSize);
+    for (auto i = 0u; i < numStrings; i++) {
+        compressedOffsetChunk->setValue<string_offset_t>(compressedData.size(), i);
+        encoder.compress(getString(i), compressedData);
+    }
+    compressedOffsetChunk->setNumValues(numStrings);
+    auto compressedDataChunk = ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT8(),
+        false /*enableCompression*/, compressedData.size(), ResidencyState::IN_MEMORY,
+        false /*hasNullData*/);
+    memcpy(compressedDataChunk->getData(), compressedData.data(), compressedData.size());
+    compressedDataChunk->setNumValues(compressedData.size());
+    return CompressedStringData{std::move(compressedDataChunk), std::move(compressedOffsetChunk),
+        std::move(metadata)};
+}
+
+void DictionaryChunk::decompressStringData(const FSSTMetadata& metadata) {
+    const auto numStrings = offsetChunk->getNumValues();
+    const auto compressedSize = stringDataChunk->getNumValues();
+    const auto compressedData = stringDataChunk->getData();
+    std::string data;
+    data.reserve(compressedSize * 2);
+    for (auto i = 0u; i < numStrings; i++) {
+        const auto startOffset = offsetChunk->getValue<string_offset_t>(i);
+        const auto endOffset = i + 1 < numStrings ?
+                                   offsetChunk->getValue<string_offset_t>(i + 1) :
+                                   compressedSize;
+        KU_ASSERT(startOffset <= endOffset && endOffset <= compressedSize);
+        offsetChunk->setValue<string_offset_t>(data.size(), i);
+        FSSTCompression::decompress(metadata, compressedData + startOffset,
+            endOffset - startOffset, data);
+    }
+    if (data.size() > stringDataChunk->getCapacity()) {
+        stringDataChunk->resize(std::bit_ceil(data.size()));
+    }
+    memcpy(stringDataChunk->getData(), data.data(), data.size());
+    stringDataChunk->setNumValues(data.size());
+}
+
+void DictionaryChunk::setFSSTMetadata(ColumnChunkData& stringDataChunk,
+    const FSSTMetadata& metadata) {
+    auto& compMeta = stringDataChunk.getMetadata().compMeta;
+    KU_ASSERT(compMeta.compression == CompressionType::UNCOMPRESSED);
+    compMeta.compression = CompressionType::FSST;
+    compMeta.extraMetadata = std::make_unique<FSSTMetadata>(metadata);
 }
 
 void DictionaryChunk::serialize(Serializer& serializer) const {
@@ -5,6 +5,7 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst_compression.h"
 #include "storage/storage_structure/disk_array_collection.h"
 #include "storage/store/string_column.h"
 #include <bit>
@@ -49,6 +50,9 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& state,
     }
     offsetColumn->scan(transaction,
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET), offsetChunk);
+    if (dataMetadata.compMeta.compression == CompressionType::FSST) {
+        dictChunk.decompressStringData(*dataMetadata.compMeta.fsstMetadata());
+    }
 }
 
 void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetState,
@@ -57,9 +61,10 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetSt
     string_index_t firstOffsetToScan = 0, lastOffsetToScan = 0;
     auto comp = [](auto pair1, auto pair2) { return pair1.first < pair2.first; };
     auto duplicationFactor = (double)offsetState.metadata.numValues / indexMeta.numValues;
-    if (duplicationFactor <= 0.5) {
-        // If at least 50% of strings are duplicated, sort the offsets so we can re-use scanned
-        // strings
+    if (duplicationFactor < 1) {
+        // If any strings are duplicated, sort the offsets so that each dictionary entry is scanned
+        // once and its duplicates in the result vector share the scanned string (including its
+        // overflow buffer, which lets comparisons and hashing skip over the string data)
         std::sort(offsetsToScan.begin(), offsetsToScan.end(), comp);
         firstOffsetToScan = offsetsToScan.front().first;
         lastOffsetToScan = offsetsToScan.back().first;
@@ -89,19 +94,26 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetSt
             offsetsToScan[pos].second);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
         // For each string which has the same index in the dictionary as the one we scanned,
-        // copy the scanned string to its position in the result vector
+        // point its position in the result vector at the scanned string. The string data is not
+        // copied, so all duplicates share the overflow buffer of the scanned string.
         while (pos + 1 < offsetsToScan.size() &&
                offsetsToScan[pos + 1].first == offsetsToScan[pos].first) {
             pos++;
-            resultVector->setValue<ku_string_t>(offsetsToScan[pos].second, scannedString);
+            resultVector->getValue<ku_string_t>(offsetsToScan[pos].second) = scannedString;
         }
     }
 }
 
 string_index_t DictionaryColumn::append(const DictionaryChunk& dictChunk, ChunkState& state,
     std::string_view val) {
-    const auto startOffset = dataColumn->appendValues(*dictChunk.getStringDataChunk(),
-        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
+    auto& dataState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA);
+    std::vector<uint8_t> compressedVal;
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        FSSTEncoder{*dataState.metadata.compMeta.fsstMetadata()}.compress(val, compressedVal);
+        val = std::string_view(reinterpret_cast<const char*>(compressedVal.data()),
+            compressedVal.size());
+    }
+    const auto startOffset = dataColumn->appendValues(*dictChunk.getStringDataChunk(), dataState,
         reinterpret_cast<const uint8_t*>(val.data()), nullptr /*nullChunkData*/, val.size());
     return offsetColumn->appendValues(*dictChunk.getOffsetChunk(),
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET),
@@ -125,6 +137,15 @@ void DictionaryColumn::scanValueToVector(Transaction* transaction, const ChunkSt
     uint64_t startOffset, uint64_t endOffset, ValueVector* resultVector,
     uint64_t offsetInVector) const {
     KU_ASSERT(endOffset >= startOffset);
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        std::vector<uint8_t> compressedString(endOffset - startOffset);
+        dataColumn->scan(transaction, dataState, startOffset, endOffset, compressedString.data());
+        std::string decompressedString;
+        FSSTCompression::decompress(*dataState.metadata.compMeta.fsstMetadata(),
+            compressedString.data(), compressedString.size(), decompressedString);
+        StringVector::addString(resultVector, offsetInVector, decompressedString);
+        return;
+    }
     // Add string to vector first and read directly into the vector
     auto& kuString =
         StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
@@ -137,6 +158,11 @@ void DictionaryColumn::scanValueToVector(Transaction* transaction, const ChunkSt
 
 bool DictionaryColumn::canCommitInPlace(const ChunkState& state, uint64_t numNewStrings,
     uint64_t totalStringLengthToAdd) {
+    if (StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA)
+            .metadata.compMeta.compression == CompressionType::FSST) {
+        // New strings are encoded with the existing symbol table, which may not fit them well.
+        totalStringLengthToAdd = FSSTCompression::getMaxCompressedSize(totalStringLengthToAdd);
+    }
     if (!canDataCommitInPlace(
             StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
             totalStringLengthToAdd)) {
@@ -153,7 +179,7 @@ bool DictionaryColumn::canCommitInPlace(const ChunkState& state, uint64_t numNew
 
 bool DictionaryColumn::canDataCommitInPlace(const ChunkState& dataState,
     uint64_t totalStringLengthToAdd) {
-    // Make sure there is sufficient space in the data chunk (not currently compressed)
+    // Make sure there is sufficient space in the data chunk
     auto totalStringDataAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
     if (totalStringDataAfterUpdate > dataState.metadata.numPages * KUZU_PAGE_SIZE) {
         // Data cannot be updated in place
@@ -253,6 +253,15 @@ bool NodeGroup::hasDeletions(const Transaction* transaction) {
     return false;
 }
 
+row_idx_t NodeGroup::getNumVisibleRows(const Transaction* transaction) {
+    const auto lock = chunkedGroups.lock();
+    row_idx_t numVisibleRows = 0u;
+    for (auto i = 0u; i < chunkedGroups.getNumGroups(lock); i++) {
+        numVisibleRows += chunkedGroups.getGroup(lock, i)->getNumVisibleRows(transaction);
+    }
+    return numVisibleRows;
+}
+
 void NodeGroup::addColumn(Transaction* transaction, TableAddColumnState& addColumnState,
     FileHandle* dataFH) {
     dataTypes.push_back(addColumnState.propertyDefinition.getType().copy());
@@ -97,6 +97,21 @@ row_idx_t NodeTable::getNumTotalRows(const Transaction* transaction) {
     return numLocalRows + nodeGroups->getNumTotalRows();
 }
 
+row_idx_t NodeTable::getNumVisibleRows(const Transaction* transaction) const {
+    row_idx_t numRows = 0u;
+    for (auto i = 0u; i < nodeGroups->getNumNodeGroups(); i++) {
+        numRows += nodeGroups->getNodeGroup(i)->getNumVisibleRows(transaction);
+    }
+    if (const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
+            LocalStorage::NotExistAction::RETURN_NULL)) {
+        auto& localNodeTable = localTable->cast<LocalNodeTable>();
+        for (auto i = 0u; i < localNodeTable.getNumNodeGroups(); i++) {
+            numRows += localNodeTable.getNodeGroup(i)->getNumVisibleRows(transaction);
+        }
+    }
+    return numRows;
+}
+
 void NodeTable::initScanState(Transaction* transaction, TableScanState& scanState) const {
     auto& nodeScanState = scanState.cast<NodeTableScanState>();
     NodeGroup* nodeGroup = nullptr;
@@ -25,7 +25,8 @@ RelTableScanState::RelTableScanState(MemoryManager& mm, table_id_t tableID,
     std::vector<ColumnPredicateSet> columnPredicateSets)
     : TableScanState{tableID, columnIDs, columns, std::move(columnPredicateSets)},
       direction{direction}, currBoundNodeIdx{0}, csrOffsetColumn{csrOffsetCol},
-      csrLengthColumn{csrLengthCol}, localTableScanState{nullptr} {
+      csrLengthColumn{csrLengthCol}, persistentStartRow{0}, persistentEndRow{INVALID_ROW_IDX},
+      localTableScanState{nullptr} {
     nodeGroupScanState = std::make_unique<CSRNodeGroupScanState>(mm, this->columnIDs.size());
     if (!this->columnPredicateSets.empty()) {
         // Since we insert a nbr column. We need to pad an empty nbr column predicate set.
@@ -38,7 +39,7 @@ void RelTableScanState::initState(Transaction* transaction, NodeGroup* nodeGroup
     initCachedBoundNodeIDSelVector();
     if (this->nodeGroup) {
         initStateForCommitted(transaction);
-    } else if (hasUnComittedData()) {
+    } else if (hasUnComittedData() && scanNonPersistentRows()) {
         initStateForUncommitted();
     } else {
         source = TableScanSource::NONE;
@@ -80,7 +81,7 @@ bool RelTableScanState::scanNext(Transaction* transaction) {
         case TableScanSource::COMMITTED: {
             const auto scanResult = nodeGroup->scan(transaction, *this);
             if (scanResult == NODE_GROUP_SCAN_EMMPTY_RESULT) {
-                if (hasUnComittedData()) {
+                if (hasUnComittedData() && scanNonPersistentRows()) {
                     initStateForUncommitted();
                 } else {
                     source = TableScanSource::NONE;
@@ -103,6 +104,19 @@ bool RelTableScanState::scanNext(Transaction* transaction) {
     }
 }
 
+row_idx_t RelTableScanState::getNumPersistentRowsOfBoundNode() const {
+    KU_ASSERT(cachedBoundNodeSelVector.getSelSize() == 1);
+    if (source != TableScanSource::COMMITTED) {
+        return 0;
+    }
+    const auto& csrScanState = nodeGroupScanState->constCast<CSRNodeGroupScanState>();
+    if (csrScanState.source != CSRNodeGroupScanSource::COMMITTED_PERSISTENT) {
+        return 0;
+    }
+    const auto boundNodeOffset = nodeIDVector->readNodeOffset(cachedBoundNodeSelVector[0]);
+    return csrScanState.header->getCSRLength(boundNodeOffset % StorageConstants::NODE_GROUP_SIZE);
+}
+
 void RelTableScanState::setNodeIDVectorToFlat(sel_t selPos) const {
     nodeIDVector->state->setToFlat();
     nodeIDVector->state->getSelVectorShared()->setToFiltered(1);
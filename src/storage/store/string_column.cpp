@@ -52,10 +52,20 @@ std::unique_ptr<ColumnChunkData> StringColumn::flushChunkData(const ColumnChunkD
     flushedStringData.setIndexChunk(
         Column::flushChunkData(*stringChunk.getIndexColumnChunk(), dataFH));
     auto& dictChunk = stringChunk.getDictionaryChunk();
-    flushedStringData.getDictionaryChunk().setOffsetChunk(
-        Column::flushChunkData(*dictChunk.getOffsetChunk(), dataFH));
-    flushedStringData.getDictionaryChunk().setStringDataChunk(
-        Column::flushChunkData(*dictChunk.getStringDataChunk(), dataFH));
+    auto& flushedDictChunk = flushedStringData.getDictionaryChunk();
+    if (auto compressedData = dictChunk.compressStringData()) {
+        flushedDictChunk.setOffsetChunk(
+            Column::flushChunkData(*compressedData->offsetChunk, dataFH));
+        flushedDictChunk.setStringDataChunk(
+            Column::flushChunkData(*compressedData->stringDataChunk, dataFH));
+        DictionaryChunk::setFSSTMetadata(*flushedDictChunk.getStringDataChunk(),
+            compressedData->metadata);
+    } else {
+        flushedDictChunk.setOffsetChunk(
+            Column::flushChunkData(*dictChunk.getOffsetChunk(), dataFH));
+        flushedDictChunk.setStringDataChunk(
+            Column::flushChunkData(*dictChunk.getStringDataChunk(), dataFH));
+    }
     return flushedChunkData;
 }
 
@@ -1,6 +1,8 @@
 #include "storage/store/update_info.h"
 
 #include <algorithm>
+#include <bit>
+#include <bitset>
 
 #include "common/exception/runtime.h"
 #include "common/vector/value_vector.h"
@@ -15,27 +17,72 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
+idx_t VectorUpdateInfo::findRow(sel_t rowInVector) const {
+    const auto end = rowsInVector.begin() + numRowsUpdated;
+    const auto itr = std::find(rowsInVector.begin(), end, rowInVector);
+    return itr == end ? INVALID_IDX : itr - rowsInVector.begin();
+}
+
+void VectorUpdateInfo::appendRow(sel_t rowInVector, const ValueVector& values) {
+    KU_ASSERT(numRowsUpdated < DEFAULT_VECTOR_CAPACITY);
+    if (numRowsUpdated == data->getCapacity()) {
+        data->resize(std::min<uint64_t>(numRowsUpdated * 2, DEFAULT_VECTOR_CAPACITY));
+    }
+    rowsInVector.push_back(rowInVector);
+    data->write(&values, values.state->getSelVector()[0], numRowsUpdated++);
+}
+
+void VectorUpdateInfo::addOwnRow(sel_t rowInVector) {
+    if (!isDelta && !isOwnRow(rowInVector)) {
+        ownRows.push_back(rowInVector);
+    }
+}
+
+bool VectorUpdateInfo::isOwnRow(sel_t rowInVector) const {
+    if (isDelta) {
+        return findRow(rowInVector) != INVALID_IDX;
+    }
+    return std::find(ownRows.begin(), ownRows.end(), rowInVector) != ownRows.end();
+}
+
+void VectorUpdateInfo::copyRows(const VectorUpdateInfo& other) {
+    if (numRowsUpdated == 0) {
+        rowsInVector.assign(other.rowsInVector.begin(),
+            other.rowsInVector.begin() + other.numRowsUpdated);
+        data->append(other.data.get(), 0, other.numRowsUpdated);
+        numRowsUpdated = other.numRowsUpdated;
+        return;
+    }
+    for (auto i = 0u; i < other.numRowsUpdated; i++) {
+        auto idx = findRow(other.rowsInVector[i]);
+        if (idx == INVALID_IDX) {
+            KU_ASSERT(numRowsUpdated < data->getCapacity());
+            rowsInVector.push_back(other.rowsInVector[i]);
+            idx = numRowsUpdated++;
+        }
+        data->write(other.data.get(), i, idx, 1);
+    }
+}
+
+static bool isVisible(const VectorUpdateInfo& vectorInfo, const Transaction* transaction) {
+    return vectorInfo.version == transaction->getID() ||
+           vectorInfo.version <= transaction->getStartTS();
+}
+
 VectorUpdateInfo* UpdateInfo::update(MemoryManager& memoryManager, const Transaction* transaction,
     const idx_t vectorIdx, const sel_t rowIdxInVector, const ValueVector& values) {
     auto& vectorUpdateInfo = getOrCreateVectorInfo(memoryManager, transaction, vectorIdx,
         rowIdxInVector, values.dataType);
     // Check if the row is already updated in this transaction. Overwrite if so.
-    idx_t idxInUpdateData = INVALID_IDX;
-    for (auto i = 0u; i < vectorUpdateInfo.numRowsUpdated; i++) {
-        if (vectorUpdateInfo.rowsInVector[i] == rowIdxInVector) {
-            idxInUpdateData = i;
-            break;
-        }
-    }
-    if (idxInUpdateData != INVALID_IDX) {
+    if (const auto idxInUpdateData = vectorUpdateInfo.findRow(rowIdxInVector);
+        idxInUpdateData != INVALID_IDX) {
         // Overwrite existing update value.
         vectorUpdateInfo.data->write(&values, values.state->getSelVector()[0], idxInUpdateData);
     } else {
         // Append new value and update `rowsInVector`.
-        vectorUpdateInfo.rowsInVector[vectorUpdateInfo.numRowsUpdated] = rowIdxInVector;
-        vectorUpdateInfo.data->write(&values, values.state->getSelVector()[0],
-            vectorUpdateInfo.numRowsUpdated++);
+        vectorUpdateInfo.appendRow(rowIdxInVector, values);
     }
+    vectorUpdateInfo.addOwnRow(rowIdxInVector);
     return &vectorUpdateInfo;
 }
 
@@ -58,12 +105,41 @@ VectorUpdateInfo* UpdateInfo::getVectorInfo(const Transaction* transaction, idx_
     return nullptr;
 }
 
+void UpdateInfo::iterateVectorInfo(const Transaction* transaction, idx_t idx,
+    const std::function<void(const VectorUpdateInfo&)>& func) const {
+    const auto newest = getVectorInfo(transaction, idx);
+    if (!newest) {
+        return;
+    }
+    if (!newest->isDelta) {
+        func(*newest);
+        return;
+    }
+    std::vector<const VectorUpdateInfo*> visibleInfos;
+    for (auto current = newest; current; current = current->getPrev()) {
+        if (isVisible(*current, transaction)) {
+            visibleInfos.push_back(current);
+            if (!current->isDelta) {
+                break;
+            }
+        }
+    }
+    for (auto i = visibleInfos.size(); i > 0; i--) {
+        func(*visibleInfos[i - 1]);
+    }
+}
+
 row_idx_t UpdateInfo::getNumUpdatedRows(const Transaction* transaction) const {
     row_idx_t numUpdatedRows = 0u;
     for (auto i = 0u; i < vectorsInfo.size(); i++) {
-        if (const auto vectorInfo = getVectorInfo(transaction, i)) {
-            numUpdatedRows += vectorInfo->numRowsUpdated;
-        }
+        // Rows can be updated in more than one of the versions we read.
+        std::bitset<DEFAULT_VECTOR_CAPACITY> updatedRows;
+        iterateVectorInfo(transaction, i, [&](const VectorUpdateInfo& vectorInfo) {
+            for (auto j = 0u; j < vectorInfo.numRowsUpdated; j++) {
+                updatedRows.set(vectorInfo.rowsInVector[j]);
+            }
+        });
+        numUpdatedRows += updatedRows.count();
     }
     return numUpdatedRows;
 }
@@ -75,19 +151,35 @@ bool UpdateInfo::hasUpdates(const Transaction* transaction, row_idx_t startRow,
     auto [endVectorIdx, rowInEndVector] =
         StorageUtils::getQuotientRemainder(startRow + numRows, DEFAULT_VECTOR_CAPACITY);
     for (idx_t vectorIdx = startVector; vectorIdx <= endVectorIdx; ++vectorIdx) {
-        const auto updateVector = getVectorInfo(transaction, vectorIdx);
-        if (!updateVector || updateVector->numRowsUpdated == 0) {
-            continue;
-        }
         const auto startRowInVector = (vectorIdx == startVector) ? rowInStartVector : 0;
         const auto endRowInVector =
             (vectorIdx == endVectorIdx) ? rowInEndVector : DEFAULT_VECTOR_CAPACITY;
-        for (auto row = startRowInVector; row <= endRowInVector; row++) {
-            if (std::any_of(updateVector->rowsInVector.begin(),
-                    updateVector->rowsInVector.begin() + updateVector->numRowsUpdated,
-                    [&](row_idx_t updatedRow) { return row == updatedRow; })) {
-                return true;
-            }
+        bool hasUpdatesInRange = false;
+        iterateVectorInfo(transaction, vectorIdx, [&](const VectorUpdateInfo& vectorInfo) {
+            hasUpdatesInRange |= std::any_of(vectorInfo.rowsInVector.begin(),
+                vectorInfo.rowsInVector.begin() + vectorInfo.numRowsUpdated,
+                [&](row_idx_t updatedRow) {
+                    return updatedRow >= startRowInVector && updatedRow < endRowInVector;
+                });
+        });
+        if (hasUpdatesInRange) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UpdateInfo::isUpdatedByConcurrentTransaction(const Transaction* transaction, idx_t vectorIdx,
+    sel_t rowIdxInVector) const {
+    if (vectorIdx >= vectorsInfo.size()) {
+        return false;
+    }
+    // Versions of concurrent transactions can be anywhere in the chain, as an older uncommitted
+    // version may be followed by newer committed ones. Rows that a version copied from older
+    // versions are not written by its transaction, so they do not conflict.
+    for (auto current = vectorsInfo[vectorIdx].get(); current; current = current->getPrev()) {
+        if (!isVisible(*current, transaction) && current->isOwnRow(rowIdxInVector)) {
+            return true;
         }
     }
     return false;
@@ -104,42 +196,43 @@ VectorUpdateInfo& UpdateInfo::getOrCreateVectorInfo(MemoryManager& memoryManager
             transaction->getID(), dataType.copy());
         return *vectorsInfo[vectorIdx];
     }
-    auto* current = vectorsInfo[vectorIdx].get();
-    VectorUpdateInfo* info = nullptr;
-    while (current) {
+    // A conflicting version can be of an uncommitted transaction (version is transaction ID) or of
+    // a transaction committed after this transaction started.
+    if (isUpdatedByConcurrentTransaction(transaction, vectorIdx, rowIdxInVector)) {
+        throw RuntimeException("Write-write conflict of updating the same row.");
+    }
+    bool hasConcurrentVersions = false;
+    for (auto current = vectorsInfo[vectorIdx].get(); current; current = current->getPrev()) {
         if (current->version == transaction->getID()) {
             // Same transaction.
             KU_ASSERT(current->version >= Transaction::START_TRANSACTION_ID);
-            info = current;
-        } else if (current->version > transaction->getStartTS()) {
-            // Potentially there can be conflicts. `current` can be uncommitted transaction (version
-            // is transaction ID) or committed transaction started after this transaction.
-            for (auto i = 0u; i < current->numRowsUpdated; i++) {
-                if (current->rowsInVector[i] == rowIdxInVector) {
-                    throw RuntimeException("Write-write conflict of updating the same row.");
-                }
-            }
-        }
-        current = current->next;
-    }
-    if (!info) {
-        // Create a new version here.
-        auto newInfo = std::make_unique<VectorUpdateInfo>(memoryManager, transaction->getID(),
-            dataType.copy());
-        vectorsInfo[vectorIdx]->next = newInfo.get();
-        newInfo->prev = std::move(vectorsInfo[vectorIdx]);
-        vectorsInfo[vectorIdx] = std::move(newInfo);
-        info = vectorsInfo[vectorIdx].get();
-        if (info->prev) {
-            // Copy the data from the previous version.
-            for (auto i = 0u; i < info->prev->numRowsUpdated; i++) {
-                info->rowsInVector[i] = info->prev->rowsInVector[i];
-            }
-            info->data->append(info->prev->data.get(), 0, info->prev->numRowsUpdated);
-            info->numRowsUpdated = info->prev->numRowsUpdated;
+            return *current;
         }
+        hasConcurrentVersions |= !isVisible(*current, transaction);
+    }
+    // Create a new version here. If another transaction may still commit updates to this vector,
+    // the new version only holds the updates of this transaction. Otherwise, it copies the
+    // updates visible to this transaction, so readers do not need to look at older versions.
+    uint64_t numRowsToCopy = 0;
+    if (!hasConcurrentVersions) {
+        iterateVectorInfo(transaction, vectorIdx, [&](const VectorUpdateInfo& vectorInfo) {
+            numRowsToCopy += vectorInfo.numRowsUpdated;
+        });
+        numRowsToCopy = std::min<uint64_t>(numRowsToCopy, DEFAULT_VECTOR_CAPACITY);
+    }
+    auto newInfo = std::make_unique<VectorUpdateInfo>(memoryManager, transaction->getID(),
+        dataType.copy(),
+        std::max<uint64_t>(VectorUpdateInfo::INITIAL_CAPACITY, std::bit_ceil(numRowsToCopy)));
+    if (hasConcurrentVersions) {
+        newInfo->isDelta = true;
+    } else {
+        iterateVectorInfo(transaction, vectorIdx,
+            [&](const VectorUpdateInfo& vectorInfo) { newInfo->copyRows(vectorInfo); });
     }
-    return *info;
+    vectorsInfo[vectorIdx]->next = newInfo.get();
+    newInfo->prev = std::move(vectorsInfo[vectorIdx]);
+    vectorsInfo[vectorIdx] = std::move(newInfo);
+    return *vectorsInfo[vectorIdx];
 }
 
 } // namespace storage
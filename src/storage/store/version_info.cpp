@@ -134,6 +134,20 @@ bool VectorVersionInfo::isDeleted(const transaction_t startTS, const transaction
     }
 }
 
+bool VectorVersionInfo::isDeletedByConcurrentTransaction(const transaction_t startTS,
+    const transaction_t transactionID, const row_idx_t rowIdx) const {
+    if (deletionStatus == DeletionStatus::NO_DELETED) {
+        return false;
+    }
+    transaction_t deletion = INVALID_TRANSACTION;
+    if (isSameDeletionVersion()) {
+        deletion = sameDeletionVersion;
+    } else if (deletedVersions) {
+        deletion = deletedVersions->operator[](rowIdx);
+    }
+    return deletion != INVALID_TRANSACTION && deletion != transactionID && deletion > startTS;
+}
+
 bool VectorVersionInfo::isInserted(const transaction_t startTS, const transaction_t transactionID,
     const row_idx_t rowIdx) const {
     switch (insertionStatus) {
@@ -173,6 +187,28 @@ row_idx_t VectorVersionInfo::getNumDeletions(transaction_t startTS, transaction_
     return numDeletions;
 }
 
+row_idx_t VectorVersionInfo::getNumVisibleRows(transaction_t startTS, transaction_t transactionID,
+    row_idx_t startRow, length_t numRows) const {
+    if (insertionStatus == InsertionStatus::NO_INSERTED) {
+        return 0;
+    }
+    if (deletionStatus == DeletionStatus::NO_DELETED) {
+        if (insertionStatus == InsertionStatus::ALWAYS_INSERTED) {
+            return numRows;
+        }
+        if (isSameInsertionVersion()) {
+            return isInserted(startTS, transactionID, startRow) ? numRows : 0;
+        }
+    }
+    row_idx_t numVisibleRows = 0u;
+    for (auto i = 0u; i < numRows; i++) {
+        const auto rowIdx = startRow + i;
+        numVisibleRows += isInserted(startTS, transactionID, rowIdx) &&
+                          !isDeleted(startTS, transactionID, rowIdx);
+    }
+    return numVisibleRows;
+}
+
 void VectorVersionInfo::rollbackInsertions(row_idx_t startRowInVector, row_idx_t numRows) {
     if (isSameInsertionVersion()) {
         // This implicitly assumes that all rows are inserted in the same transaction, so regardless
@@ -466,6 +502,34 @@ row_idx_t VersionInfo::getNumDeletions(const transaction::Transaction* transacti
     return numDeletions;
 }
 
+row_idx_t VersionInfo::getNumVisibleRows(const transaction::Transaction* transaction,
+    row_idx_t startRow, length_t numRows) const {
+    if (numRows == 0) {
+        return 0;
+    }
+    auto [startVector, startRowInVector] =
+        StorageUtils::getQuotientRemainder(startRow, DEFAULT_VECTOR_CAPACITY);
+    auto [endVectorIdx, endRowInVector] =
+        StorageUtils::getQuotientRemainder(startRow + numRows - 1, DEFAULT_VECTOR_CAPACITY);
+    idx_t vectorIdx = startVector;
+    row_idx_t numVisibleRows = 0u;
+    while (vectorIdx <= endVectorIdx) {
+        const auto rowInVector = vectorIdx == startVector ? startRowInVector : 0;
+        const auto numRowsInVector = vectorIdx == endVectorIdx ?
+                                         endRowInVector - rowInVector + 1 :
+                                         DEFAULT_VECTOR_CAPACITY - rowInVector;
+        const auto vectorVersion = getVectorVersionInfo(vectorIdx);
+        if (vectorVersion) {
+            numVisibleRows += vectorVersion->getNumVisibleRows(transaction->getStartTS(),
+                transaction->getID(), rowInVector, numRowsInVector);
+        } else {
+            numVisibleRows += numRowsInVector;
+        }
+        vectorIdx++;
+    }
+    return numVisibleRows;
+}
+
 bool VersionInfo::hasInsertions() const {
     for (auto& vectorInfo : vectorsInfo) {
         if (vectorInfo &&
@@ -488,6 +552,18 @@ bool VersionInfo::isDeleted(const transaction::Transaction* transaction,
     return false;
 }
 
+bool VersionInfo::isDeletedByConcurrentTransaction(const transaction::Transaction* transaction,
+    row_idx_t rowInChunk) const {
+    auto [vectorIdx, rowInVector] =
+        StorageUtils::getQuotientRemainder(rowInChunk, DEFAULT_VECTOR_CAPACITY);
+    const auto vectorVersion = getVectorVersionInfo(vectorIdx);
+    if (vectorVersion) {
+        return vectorVersion->isDeletedByConcurrentTransaction(transaction->getStartTS(),
+            transaction->getID(), rowInVector);
+    }
+    return false;
+}
+
 bool VersionInfo::isInserted(const transaction::Transaction* transaction,
     row_idx_t rowInChunk) const {
     auto [vectorIdx, rowInVector] =
@@ -312,7 +312,9 @@ void UndoBuffer::rollbackVectorUpdateInfo(const uint8_t* record) const {
         // Has newer versions. Simply remove the current one from the version chain.
         const auto newerVersion = undoRecord.vectorUpdateInfo->getNext();
         auto prevVersion = undoRecord.vectorUpdateInfo->movePrev();
-        prevVersion->next = newerVersion;
+        if (prevVersion) {
+            prevVersion->next = newerVersion;
+        }
         newerVersion->setPrev(std::move(prevVersion));
     } else {
         // This is the begin of the version chain.
@@ -76,20 +76,41 @@ page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t origina
 
 void ShadowFile::replayShadowPageRecords(ClientContext& context) const {
     std::unordered_map<DBFileID, std::unique_ptr<FileInfo>> fileCache;
-    const auto pageBuffer = std::make_unique<uint8_t[]>(KUZU_PAGE_SIZE);
-    page_idx_t shadowPageIdx = 1; // Skip header page.
-    for (const auto& record : shadowPageRecords) {
-        const auto& dbFileID = record.dbFileID;
-        if (!fileCache.contains(dbFileID)) {
-            fileCache.insert(std::make_pair(dbFileID, getFileInfo(context, dbFileID)));
+    // Shadow pages are read in batches of consecutive pages, and the pages of each batch are
+    // written back to their db files together, so that adjacent pages are written in one call.
+    const auto numPagesPerBatch =
+        std::min<uint64_t>(REPLAY_BATCH_NUM_PAGES, shadowPageRecords.size());
+    const auto pageBuffer = std::make_unique<uint8_t[]>(numPagesPerBatch * KUZU_PAGE_SIZE);
+    std::unordered_map<DBFileID, std::vector<FileIORequest>> writeRequests;
+    for (auto startIdx = 0u; startIdx < shadowPageRecords.size(); startIdx += numPagesPerBatch) {
+        const auto numPagesInBatch =
+            std::min<uint64_t>(numPagesPerBatch, shadowPageRecords.size() - startIdx);
+        // Skip header page.
+        shadowingFH->readPagesFromDisk(pageBuffer.get(), startIdx + 1, numPagesInBatch);
+        for (auto& [_, requests] : writeRequests) {
+            requests.clear();
+        }
+        for (auto i = 0u; i < numPagesInBatch; i++) {
+            const auto& record = shadowPageRecords[startIdx + i];
+            if (!fileCache.contains(record.dbFileID)) {
+                fileCache.insert(
+                    std::make_pair(record.dbFileID, getFileInfo(context, record.dbFileID)));
+            }
+            writeRequests[record.dbFileID].push_back(FileIORequest{
+                pageBuffer.get() + i * KUZU_PAGE_SIZE, KUZU_PAGE_SIZE,
+                static_cast<uint64_t>(record.originalPageIdx) * KUZU_PAGE_SIZE});
+        }
+        for (auto& [dbFileID, requests] : writeRequests) {
+            fileCache.at(dbFileID)->writeFileBatch(requests);
+        }
+        for (auto i = 0u; i < numPagesInBatch; i++) {
+            const auto& record = shadowPageRecords[startIdx + i];
+            // NOTE: We're not taking lock here, as we assume this is only called with single
+            // thread.
+            context.getMemoryManager()->getBufferManager()->updateFrameIfPageIsInFrameWithoutLock(
+                record.originalFileIdx, pageBuffer.get() + i * KUZU_PAGE_SIZE,
+                record.originalPageIdx);
         }
-        const auto& fileInfoOfDBFile = fileCache.at(dbFileID);
-        shadowingFH->readPageFromDisk(pageBuffer.get(), shadowPageIdx++);
-        fileInfoOfDBFile->writeFile(pageBuffer.get(), KUZU_PAGE_SIZE,
-            record.originalPageIdx * KUZU_PAGE_SIZE);
-        // NOTE: We're not taking lock here, as we assume this is only called with single thread.
-        context.getMemoryManager()->getBufferManager()->updateFrameIfPageIsInFrameWithoutLock(
-            record.originalFileIdx, pageBuffer.get(), record.originalPageIdx);
     }
 }
 
@@ -5,10 +5,14 @@
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "common/file_system/file_info.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/exception/runtime.h"
 #include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "common/string_format.h"
 #include "common/vector/value_vector.h"
 #include "main/db_config.h"
+#include "storage/storage_version_info.h"
 
 using namespace kuzu::catalog;
 using namespace kuzu::common;
@@ -19,7 +23,7 @@ namespace storage {
 
 WAL::WAL(const std::string& directory, bool readOnly, VirtualFileSystem* vfs,
     main::ClientContext* context)
-    : directory{directory}, vfs{vfs} {
+    : directory{directory}, vfs{vfs}, headerWritten{false} {
     if (main::DBConfig::isDBPathInMemory(directory)) {
         return;
     }
@@ -33,6 +37,7 @@ WAL::WAL(const std::string& directory, bool readOnly, VirtualFileSystem* vfs,
     // records not replayed. This can happen if checkpoint is not triggered before the Database is
     // closed last time.
     bufferedWriter->setFileOffset(fileInfo->getFileSize());
+    headerWritten = fileInfo->getFileSize() > 0;
 }
 
 WAL::~WAL() {}
@@ -148,6 +153,7 @@ void WAL::clearWAL() {
     bufferedWriter->getFileInfo().truncate(0);
     bufferedWriter->resetOffsets();
     updatedTables.clear();
+    headerWritten = false;
 }
 
 void WAL::flushAllPages() {
@@ -158,9 +164,43 @@ void WAL::flushAllPages() {
 void WAL::addNewWALRecordNoLock(const WALRecord& walRecord) {
     KU_ASSERT(walRecord.type != WALRecordType::INVALID_RECORD);
     KU_ASSERT(!main::DBConfig::isDBPathInMemory(directory));
+    if (!headerWritten) {
+        writeHeaderNoLock();
+    }
     Serializer serializer(bufferedWriter);
     walRecord.serialize(serializer);
 }
 
+void WAL::writeHeaderNoLock() {
+    Serializer serializer(bufferedWriter);
+    const auto numMagicBytes = strlen(StorageVersionInfo::MAGIC_BYTES);
+    for (auto i = 0u; i < numMagicBytes; i++) {
+        serializer.serializeValue<uint8_t>(StorageVersionInfo::MAGIC_BYTES[i]);
+    }
+    serializer.serializeValue(StorageVersionInfo::getStorageVersion());
+    headerWritten = true;
+}
+
+void WAL::validateHeader(Deserializer& deserializer) {
+    const auto numMagicBytes = strlen(StorageVersionInfo::MAGIC_BYTES);
+    uint8_t magicBytes[4];
+    for (auto i = 0u; i < numMagicBytes; i++) {
+        deserializer.deserializeValue<uint8_t>(magicBytes[i]);
+    }
+    if (memcmp(magicBytes, StorageVersionInfo::MAGIC_BYTES, numMagicBytes) != 0) {
+        throw RuntimeException(
+            "The WAL file is not a valid Kuzu WAL file for the current version of Kuzu.");
+    }
+    storage_version_t savedStorageVersion = 0;
+    deserializer.deserializeValue(savedStorageVersion);
+    const auto storageVersion = StorageVersionInfo::getStorageVersion();
+    if (savedStorageVersion != storageVersion) {
+        throw RuntimeException(
+            stringFormat("Trying to replay a WAL file with a different version. "
+                         "WAL file version: {}, Current build storage version: {}",
+                savedStorageVersion, storageVersion));
+    }
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -1,11 +1,18 @@
 #include "storage/wal/wal_record.h"
 
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <span>
+
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog_entry/catalog_entry.h"
 #include "common/exception/runtime.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "common/type_utils.h"
 #include "main/client_context.h"
+#include "storage/compression/compression.h"
 
 using namespace kuzu::common;
 using namespace kuzu::binder;
@@ -13,6 +20,217 @@ using namespace kuzu::binder;
 namespace kuzu {
 namespace storage {
 
+namespace {
+
+// How the values of a vector are written to the WAL. Fixed-size values are written as raw bytes,
+// and integers reuse the bitpacking of column chunks, instead of one serialized Value per row.
+enum class WALVectorEncoding : uint8_t {
+    // One serialized Value per row. Used for var-sized and nested types.
+    VALUES = 0,
+    PLAIN = 1,
+    // All non-null rows have the same value, which is written once.
+    CONSTANT = 2,
+    BITPACKED = 3,
+};
+
+bool isFixedSizeInWAL(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::BOOL:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::INTERVAL:
+    case PhysicalTypeID::INTERNAL_ID:
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint64_t getNumBitpackedBytes(uint64_t numValues, uint8_t bitWidth) {
+    // Bitpacking works on whole chunks of values.
+    const auto numChunks = (numValues + IntegerBitpacking<int64_t>::CHUNK_SIZE - 1) /
+                           IntegerBitpacking<int64_t>::CHUNK_SIZE;
+    return std::max<uint64_t>(numChunks * IntegerBitpacking<int64_t>::CHUNK_SIZE * bitWidth / 8,
+        IntegerBitpacking<int64_t>::CHUNK_SIZE);
+}
+
+template<IntegerBitpackingType T>
+bool tryWriteBitpacked(Serializer& serializer, const uint8_t* values, uint64_t numValues) {
+    const auto typedValues = std::span(reinterpret_cast<const T*>(values), numValues);
+    const auto [min, max] = std::minmax_element(typedValues.begin(), typedValues.end());
+    const CompressionMetadata metadata{StorageValue(*min), StorageValue(*max),
+        CompressionType::INTEGER_BITPACKING};
+    const auto info = IntegerBitpacking<T>::getPackingInfo(metadata);
+    if (info.bitWidth == 0 || info.bitWidth >= sizeof(T) * 8) {
+        return false;
+    }
+    const auto numBytes = getNumBitpackedBytes(numValues, info.bitWidth);
+    const auto buffer = std::make_unique<uint8_t[]>(numBytes);
+    auto srcBuffer = values;
+    IntegerBitpacking<T>().compressNextPage(srcBuffer, numValues, buffer.get(), numBytes,
+        metadata);
+    serializer.write(WALVectorEncoding::BITPACKED);
+    serializer.write<T>(*min);
+    serializer.write<T>(*max);
+    serializer.write(buffer.get(), numBytes);
+    return true;
+}
+
+template<IntegerBitpackingType T>
+void readBitpacked(Deserializer& deserializer, uint8_t* result, uint64_t numValues) {
+    T min{}, max{};
+    deserializer.deserializeValue<T>(min);
+    deserializer.deserializeValue<T>(max);
+    const CompressionMetadata metadata{StorageValue(min), StorageValue(max),
+        CompressionType::INTEGER_BITPACKING};
+    const auto numBytes =
+        getNumBitpackedBytes(numValues, IntegerBitpacking<T>::getPackingInfo(metadata).bitWidth);
+    const auto buffer = std::make_unique<uint8_t[]>(numBytes);
+    deserializer.read(buffer.get(), numBytes);
+    IntegerBitpacking<T>().decompressFromPage(buffer.get(), 0, result, 0, numValues, metadata);
+}
+
+void serializeVector(Serializer& serializer, const ValueVector& vector) {
+    serializer.writeDebuggingInfo("data_type");
+    vector.dataType.serialize(serializer);
+    serializer.writeDebuggingInfo("num_values");
+    const auto& selVector = vector.state->getSelVector();
+    const auto numValues = selVector.getSelSize();
+    serializer.write<sel_t>(numValues);
+    serializer.writeDebuggingInfo("nulls");
+    std::vector<uint64_t> nullEntries(NullMask::getNumNullEntries(numValues), 0);
+    bool hasNull = false;
+    for (auto i = 0u; i < numValues; i++) {
+        if (vector.isNull(selVector[i])) {
+            NullMask::setNull(nullEntries.data(), i, true);
+            hasNull = true;
+        }
+    }
+    serializer.write<bool>(hasNull);
+    if (hasNull) {
+        serializer.write(reinterpret_cast<const uint8_t*>(nullEntries.data()),
+            nullEntries.size() * sizeof(uint64_t));
+    }
+    serializer.writeDebuggingInfo("values");
+    const auto physicalType = vector.dataType.getPhysicalType();
+    if (!isFixedSizeInWAL(physicalType)) {
+        serializer.write(WALVectorEncoding::VALUES);
+        for (auto i = 0u; i < numValues; i++) {
+            vector.getAsValue(selVector[i])->serialize(serializer);
+        }
+        return;
+    }
+    // Gather the selected values. Null rows take the value of the first non-null row, so that they
+    // neither break constant runs nor widen the range of bitpacked values.
+    const auto numBytesPerValue = vector.getNumBytesPerValue();
+    std::vector<uint8_t> values(numValues * numBytesPerValue, 0);
+    std::optional<sel_t> firstNonNullPos;
+    for (auto i = 0u; i < numValues; i++) {
+        if (!NullMask::isNull(nullEntries.data(), i)) {
+            firstNonNullPos = selVector[i];
+            break;
+        }
+    }
+    if (firstNonNullPos.has_value()) {
+        for (auto i = 0u; i < numValues; i++) {
+            const auto pos =
+                NullMask::isNull(nullEntries.data(), i) ? *firstNonNullPos : selVector[i];
+            memcpy(values.data() + i * numBytesPerValue,
+                vector.getData() + pos * numBytesPerValue, numBytesPerValue);
+        }
+    }
+    bool isConstant = numValues > 0;
+    for (auto i = 1u; i < numValues && isConstant; i++) {
+        isConstant = memcmp(values.data(), values.data() + i * numBytesPerValue,
+                         numBytesPerValue) == 0;
+    }
+    if (isConstant) {
+        serializer.write(WALVectorEncoding::CONSTANT);
+        serializer.write(values.data(), numBytesPerValue);
+        return;
+    }
+    bool isBitpacked = false;
+    TypeUtils::visit(
+        physicalType,
+        [&]<typename T>(T)
+            requires(IntegerBitpackingType<T>)
+        { isBitpacked = tryWriteBitpacked<T>(serializer, values.data(), numValues); },
+        [](auto) {});
+    if (!isBitpacked) {
+        serializer.write(WALVectorEncoding::PLAIN);
+        serializer.write(values.data(), values.size());
+    }
+}
+
+std::unique_ptr<ValueVector> deserializeVector(Deserializer& deserializer, MemoryManager* mm,
+    std::shared_ptr<DataChunkState> dataChunkState) {
+    std::string key;
+    deserializer.validateDebuggingInfo(key, "data_type");
+    auto result = std::make_unique<ValueVector>(LogicalType::deserialize(deserializer), mm);
+    result->setState(std::move(dataChunkState));
+    deserializer.validateDebuggingInfo(key, "num_values");
+    sel_t numValues = 0;
+    deserializer.deserializeValue<sel_t>(numValues);
+    result->state->getSelVectorUnsafe().setSelSize(numValues);
+    KU_ASSERT(result->state->getSelVector().isUnfiltered());
+    deserializer.validateDebuggingInfo(key, "nulls");
+    bool hasNull = false;
+    deserializer.deserializeValue<bool>(hasNull);
+    std::vector<uint64_t> nullEntries(NullMask::getNumNullEntries(numValues), 0);
+    if (hasNull) {
+        deserializer.read(reinterpret_cast<uint8_t*>(nullEntries.data()),
+            nullEntries.size() * sizeof(uint64_t));
+    }
+    for (auto i = 0u; i < numValues; i++) {
+        result->setNull(i, NullMask::isNull(nullEntries.data(), i));
+    }
+    deserializer.validateDebuggingInfo(key, "values");
+    auto encoding = WALVectorEncoding::VALUES;
+    deserializer.deserializeValue(encoding);
+    const auto numBytesPerValue = result->getNumBytesPerValue();
+    switch (encoding) {
+    case WALVectorEncoding::VALUES: {
+        for (auto i = 0u; i < numValues; i++) {
+            const auto value = Value::deserialize(deserializer);
+            result->copyFromValue(i, *value);
+        }
+    } break;
+    case WALVectorEncoding::PLAIN: {
+        deserializer.read(result->getData(), numValues * numBytesPerValue);
+    } break;
+    case WALVectorEncoding::CONSTANT: {
+        deserializer.read(result->getData(), numBytesPerValue);
+        for (auto i = 1u; i < numValues; i++) {
+            memcpy(result->getData() + i * numBytesPerValue, result->getData(),
+                numBytesPerValue);
+        }
+    } break;
+    case WALVectorEncoding::BITPACKED: {
+        TypeUtils::visit(
+            result->dataType.getPhysicalType(),
+            [&]<typename T>(T)
+                requires(IntegerBitpackingType<T>)
+            { readBitpacked<T>(deserializer, result->getData(), numValues); },
+            [](auto) { KU_UNREACHABLE; });
+    } break;
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+    return result;
+}
+
+} // namespace
+
 void WALRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("type");
     serializer.write(type);
@@ -267,7 +485,7 @@ void TableInsertionRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("num_vectors");
     serializer.write<idx_t>(vectors.size());
     for (auto& vector : vectors) {
-        vector->serialize(serializer);
+        serializeVector(serializer, *vector);
     }
 }
 
@@ -290,7 +508,7 @@ std::unique_ptr<TableInsertionRecord> TableInsertionRecord::deserialize(Deserial
     auto resultChunkState = std::make_shared<DataChunkState>();
     valueVectors.reserve(numVectors);
     for (auto i = 0u; i < numVectors; i++) {
-        valueVectors.push_back(ValueVector::deSerialize(deserializer,
+        valueVectors.push_back(deserializeVector(deserializer,
             clientContext.getMemoryManager(), resultChunkState));
     }
     return std::make_unique<TableInsertionRecord>(tableID, tableType, numRows,
@@ -304,7 +522,7 @@ void NodeDeletionRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("node_offset");
     serializer.write<offset_t>(nodeOffset);
     serializer.writeDebuggingInfo("pk_vector");
-    pkVector->serialize(serializer);
+    serializeVector(serializer, *pkVector);
 }
 
 std::unique_ptr<NodeDeletionRecord> NodeDeletionRecord::deserialize(Deserializer& deserializer,
@@ -320,7 +538,7 @@ std::unique_ptr<NodeDeletionRecord> NodeDeletionRecord::deserialize(Deserializer
     deserializer.validateDebuggingInfo(key, "pk_vector");
     auto resultChunkState = std::make_shared<DataChunkState>();
     auto ownedVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     return std::make_unique<NodeDeletionRecord>(tableID, nodeOffset, std::move(ownedVector));
 }
 
@@ -333,7 +551,7 @@ void NodeUpdateRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("node_offset");
     serializer.write<offset_t>(nodeOffset);
     serializer.writeDebuggingInfo("property_vector");
-    propertyVector->serialize(serializer);
+    serializeVector(serializer, *propertyVector);
 }
 
 std::unique_ptr<NodeUpdateRecord> NodeUpdateRecord::deserialize(Deserializer& deserializer,
@@ -352,7 +570,7 @@ std::unique_ptr<NodeUpdateRecord> NodeUpdateRecord::deserialize(Deserializer& de
     deserializer.validateDebuggingInfo(key, "property_vector");
     auto resultChunkState = std::make_shared<DataChunkState>();
     auto ownedVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     return std::make_unique<NodeUpdateRecord>(tableID, columnID, nodeOffset,
         std::move(ownedVector));
 }
@@ -362,11 +580,11 @@ void RelDeletionRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("table_id");
     serializer.write<table_id_t>(tableID);
     serializer.writeDebuggingInfo("src_node_vector");
-    srcNodeIDVector->serialize(serializer);
+    serializeVector(serializer, *srcNodeIDVector);
     serializer.writeDebuggingInfo("dst_node_vector");
-    dstNodeIDVector->serialize(serializer);
+    serializeVector(serializer, *dstNodeIDVector);
     serializer.writeDebuggingInfo("rel_id_vector");
-    relIDVector->serialize(serializer);
+    serializeVector(serializer, *relIDVector);
 }
 
 std::unique_ptr<RelDeletionRecord> RelDeletionRecord::deserialize(Deserializer& deserializer,
@@ -379,13 +597,13 @@ std::unique_ptr<RelDeletionRecord> RelDeletionRecord::deserialize(Deserializer&
     deserializer.validateDebuggingInfo(key, "src_node_vector");
     auto resultChunkState = std::make_shared<DataChunkState>();
     auto srcNodeIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     deserializer.validateDebuggingInfo(key, "dst_node_vector");
     auto dstNodeIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     deserializer.validateDebuggingInfo(key, "rel_id_vector");
     auto relIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     return std::make_unique<RelDeletionRecord>(tableID, std::move(srcNodeIDVector),
         std::move(dstNodeIDVector), std::move(relIDVector));
 }
@@ -397,7 +615,7 @@ void RelDetachDeleteRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("direction");
     serializer.write<RelDataDirection>(direction);
     serializer.writeDebuggingInfo("src_node_vector");
-    srcNodeIDVector->serialize(serializer);
+    serializeVector(serializer, *srcNodeIDVector);
 }
 
 std::unique_ptr<RelDetachDeleteRecord> RelDetachDeleteRecord::deserialize(
@@ -413,7 +631,7 @@ std::unique_ptr<RelDetachDeleteRecord> RelDetachDeleteRecord::deserialize(
     deserializer.validateDebuggingInfo(key, "src_node_vector");
     auto resultChunkState = std::make_shared<DataChunkState>();
     auto srcNodeIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     return std::make_unique<RelDetachDeleteRecord>(tableID, direction, std::move(srcNodeIDVector));
 }
 
@@ -424,13 +642,13 @@ void RelUpdateRecord::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("column_id");
     serializer.write<column_id_t>(columnID);
     serializer.writeDebuggingInfo("src_node_vector");
-    srcNodeIDVector->serialize(serializer);
+    serializeVector(serializer, *srcNodeIDVector);
     serializer.writeDebuggingInfo("dst_node_vector");
-    dstNodeIDVector->serialize(serializer);
+    serializeVector(serializer, *dstNodeIDVector);
     serializer.writeDebuggingInfo("rel_id_vector");
-    relIDVector->serialize(serializer);
+    serializeVector(serializer, *relIDVector);
     serializer.writeDebuggingInfo("property_vector");
-    propertyVector->serialize(serializer);
+    serializeVector(serializer, *propertyVector);
 }
 
 std::unique_ptr<RelUpdateRecord> RelUpdateRecord::deserialize(Deserializer& deserializer,
@@ -446,16 +664,16 @@ std::unique_ptr<RelUpdateRecord> RelUpdateRecord::deserialize(Deserializer& dese
     deserializer.validateDebuggingInfo(key, "src_node_vector");
     auto resultChunkState = std::make_shared<DataChunkState>();
     auto srcNodeIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     deserializer.validateDebuggingInfo(key, "dst_node_vector");
     auto dstNodeIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     deserializer.validateDebuggingInfo(key, "rel_id_vector");
     auto relIDVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     deserializer.validateDebuggingInfo(key, "property_vector");
     auto propertyVector =
-        ValueVector::deSerialize(deserializer, clientContext.getMemoryManager(), resultChunkState);
+        deserializeVector(deserializer, clientContext.getMemoryManager(), resultChunkState);
     return std::make_unique<RelUpdateRecord>(tableID, columnID, std::move(srcNodeIDVector),
         std::move(dstNodeIDVector), std::move(relIDVector), std::move(propertyVector));
 }
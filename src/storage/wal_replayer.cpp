@@ -1,10 +1,17 @@
 #include "storage/wal_replayer.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "binder/binder.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "catalog/catalog_entry/type_catalog_entry.h"
+#include "common/copy_constructors.h"
 #include "common/file_system/file_info.h"
 #include "common/serializer/buffered_file.h"
 #include "main/client_context.h"
@@ -14,6 +21,7 @@
 #include "storage/storage_utils.h"
 #include "storage/store/node_table.h"
 #include "storage/store/rel_table.h"
+#include "storage/wal/wal.h"
 #include "storage/wal/wal_record.h"
 
 using namespace kuzu::binder;
@@ -26,6 +34,83 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace storage {
 
+namespace {
+
+// Deserializes WAL records on a background thread, so that reading and deserializing the WAL file
+// overlaps with applying the records. At most MAX_NUM_BUFFERED_RECORDS records are buffered.
+class WALRecordReader {
+    static constexpr uint64_t MAX_NUM_BUFFERED_RECORDS = 128;
+
+public:
+    WALRecordReader(std::unique_ptr<FileInfo> fileInfo, main::ClientContext& clientContext)
+        : finished{false}, stopped{false} {
+        thread = std::thread([this, fileInfo = std::move(fileInfo), &clientContext]() mutable {
+            readRecords(std::move(fileInfo), clientContext);
+        });
+    }
+    DELETE_COPY_AND_MOVE(WALRecordReader);
+    ~WALRecordReader() {
+        {
+            std::unique_lock lck{mtx};
+            stopped = true;
+        }
+        cv.notify_all();
+        thread.join();
+    }
+
+    // Returns nullptr once all records have been read. Rethrows any exception thrown while
+    // deserializing.
+    std::unique_ptr<WALRecord> next() {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return !records.empty() || finished; });
+        if (records.empty()) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return nullptr;
+        }
+        auto record = std::move(records.front());
+        records.pop_front();
+        cv.notify_all();
+        return record;
+    }
+
+private:
+    void readRecords(std::unique_ptr<FileInfo> fileInfo, main::ClientContext& clientContext) {
+        try {
+            Deserializer deserializer(std::make_unique<BufferedFileReader>(std::move(fileInfo)));
+            WAL::validateHeader(deserializer);
+            while (!deserializer.finished()) {
+                auto record = WALRecord::deserialize(deserializer, clientContext);
+                std::unique_lock lck{mtx};
+                cv.wait(lck, [&] { return records.size() < MAX_NUM_BUFFERED_RECORDS || stopped; });
+                if (stopped) {
+                    return;
+                }
+                records.push_back(std::move(record));
+                cv.notify_all();
+            }
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            exception = std::current_exception();
+        }
+        std::unique_lock lck{mtx};
+        finished = true;
+        cv.notify_all();
+    }
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<WALRecord>> records;
+    bool finished;
+    bool stopped;
+    std::exception_ptr exception;
+    std::thread thread;
+};
+
+} // namespace
+
 WALReplayer::WALReplayer(main::ClientContext& clientContext) : clientContext{clientContext} {
     walFilePath = clientContext.getVFSUnsafe()->joinPath(clientContext.getDatabasePath(),
         StorageConstants::WAL_FILE_SUFFIX);
@@ -43,9 +128,8 @@ void WALReplayer::replay() const {
         return;
     }
     try {
-        Deserializer deserializer(std::make_unique<BufferedFileReader>(std::move(fileInfo)));
-        while (!deserializer.finished()) {
-            auto walRecord = WALRecord::deserialize(deserializer, clientContext);
+        WALRecordReader reader(std::move(fileInfo), clientContext);
+        while (auto walRecord = reader.next()) {
             replayWALRecord(*walRecord);
         }
         if (clientContext.getTransactionContext()->hasActiveTransaction()) {
@@ -238,11 +322,12 @@ void WALReplayer::replayNodeTableInsertRecord(const WALRecord& walRecord) const
     const auto nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID());
     nodeIDVector->setState(anchorState);
     anchorState->getSelVectorUnsafe().setToFiltered(1);
+    // The vectors share anchorState, so the same insert state is reused for every row.
+    const auto insertState =
+        std::make_unique<NodeTableInsertState>(*nodeIDVector, pkVector, propertyVectors);
+    KU_ASSERT(clientContext.getTx() && clientContext.getTx()->isRecovery());
     for (auto i = 0u; i < numNodes; i++) {
         anchorState->getSelVectorUnsafe()[0] = i;
-        const auto insertState =
-            std::make_unique<NodeTableInsertState>(*nodeIDVector, pkVector, propertyVectors);
-        KU_ASSERT(clientContext.getTx() && clientContext.getTx()->isRecovery());
         table.insert(clientContext.getTx(), *insertState);
     }
 }
@@ -266,12 +351,12 @@ void WALReplayer::replayRelTableInsertRecord(const WALRecord& walRecord) const {
         }
         propertyVectors.push_back(insertionRecord.ownedVectors[i].get());
     }
+    const auto insertState = std::make_unique<RelTableInsertState>(
+        *insertionRecord.ownedVectors[LOCAL_BOUND_NODE_ID_COLUMN_ID],
+        *insertionRecord.ownedVectors[LOCAL_NBR_NODE_ID_COLUMN_ID], propertyVectors);
+    KU_ASSERT(clientContext.getTx() && clientContext.getTx()->isRecovery());
     for (auto i = 0u; i < numRels; i++) {
         anchorState->getSelVectorUnsafe()[0] = i;
-        const auto insertState = std::make_unique<RelTableInsertState>(
-            *insertionRecord.ownedVectors[LOCAL_BOUND_NODE_ID_COLUMN_ID],
-            *insertionRecord.ownedVectors[LOCAL_NBR_NODE_ID_COLUMN_ID], propertyVectors);
-        KU_ASSERT(clientContext.getTx() && clientContext.getTx()->isRecovery());
         table.insert(clientContext.getTx(), *insertState);
     }
 }
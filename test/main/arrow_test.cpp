@@ -26,3 +26,37 @@ TEST_F(ArrowTest, getArrowSchema) {
     ASSERT_EQ(std::string(schema->children[0]->name), "NAME");
     schema->release(schema.get());
 }
+
+TEST_F(ArrowTest, getArrowResultColumnar) {
+    auto query = "MATCH (a:person) RETURN a.ID, CASE WHEN a.ID < 5 THEN a.fName END, a.isStudent, "
+                 "a.eyeSight ORDER BY a.ID";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    // Chunks continue from tuples read through getNext.
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    auto arrowArray = result->getNextArrowChunk(3);
+    ASSERT_EQ(arrowArray->length, 3);
+    ASSERT_EQ(arrowArray->n_children, 4);
+    auto ids = (const int64_t*)arrowArray->children[0]->buffers[1];
+    ASSERT_EQ(ids[0], 2);
+    ASSERT_EQ(ids[1], 3);
+    ASSERT_EQ(ids[2], 5);
+    auto names = arrowArray->children[1];
+    ASSERT_EQ(names->null_count, 1);
+    ASSERT_EQ(*(const uint8_t*)names->buffers[0] & 0b111, 0b011);
+    auto offsets = (const uint32_t*)names->buffers[1];
+    ASSERT_EQ(offsets[1], 3);
+    ASSERT_EQ(offsets[2], 8);
+    ASSERT_EQ(offsets[3], 8);
+    ASSERT_EQ(std::string((const char*)names->buffers[2], 8), "BobCarol");
+    ASSERT_EQ(*(const uint8_t*)arrowArray->children[2]->buffers[1] & 0b111, 0b001);
+    auto eyeSights = (const double*)arrowArray->children[3]->buffers[1];
+    ASSERT_EQ(eyeSights[0], 5.1);
+    ASSERT_EQ(eyeSights[2], 4.8);
+    arrowArray->release(arrowArray.get());
+    arrowArray = result->getNextArrowChunk(10);
+    ASSERT_EQ(arrowArray->length, 4);
+    ASSERT_EQ(((const int64_t*)arrowArray->children[0]->buffers[1])[3], 10);
+    arrowArray->release(arrowArray.get());
+    ASSERT_FALSE(result->hasNext());
+}
@@ -1,8 +1,11 @@
 #include <memory>
 #include <thread>
 
+#include "common/exception/runtime.h"
 #include "main/connection.h"
 #include "main/database.h"
+#include "main/statement_cache.h"
+#include "planner/join_order/cardinality_feedback.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -155,6 +158,55 @@ TEST_F(ApiTest, Prepare) {
         "Connection Exception: We do not support prepare multiple statements.");
 }
 
+TEST_F(ApiTest, StatementCacheSharedAcrossConnections) {
+    auto statementCache = database->getStatementCache();
+    const auto numHits = statementCache->getNumHits();
+    const auto numEntries = statementCache->getNumEntries();
+    auto conn2 = std::make_unique<Connection>(database.get());
+    auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(statementCache->getNumEntries(), numEntries + 1);
+    result = conn2->query("  MATCH (a:person) WHERE a.ID = 0 RETURN a.fName;\n");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<std::string>(), "Alice");
+    ASSERT_EQ(statementCache->getNumHits(), numHits + 1);
+    // DDL is not cached, as its parse tree can depend on the catalog.
+    result = conn2->query("CREATE NODE TABLE T(ID INT64, PRIMARY KEY(ID));");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(statementCache->getNumEntries(), numEntries + 1);
+}
+
+TEST_F(ApiTest, CardinalityFeedbackFromHashJoinBuild) {
+    auto cardinalityFeedback = database->getCardinalityFeedback();
+    cardinalityFeedback->clear();
+    auto query = std::string("MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person)-[:knows]->"
+                             "(d:person) WHERE a.age > 30 AND d.age < 40 RETURN COUNT(*);");
+    // The logical plan printout includes the estimated cardinality of each operator.
+    auto explainLogical = [&]() {
+        auto explainResult = conn->query("EXPLAIN LOGICAL " + query);
+        EXPECT_TRUE(explainResult->isSuccess()) << explainResult->toString();
+        return explainResult->toString();
+    };
+    auto planWithoutFeedback = explainLogical();
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    auto count = result->getNext()->getValue(0)->getValue<int64_t>();
+    ASSERT_GT(cardinalityFeedback->getNumEntries(), 0);
+    // The observed build side cardinalities replace the estimates of their subquery graphs.
+    ASSERT_NE(explainLogical(), planWithoutFeedback);
+    // Planning with observed cardinalities must not change the result.
+    result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), count);
+    cardinalityFeedback->clear();
+    ASSERT_TRUE(conn->query("CALL enable_cardinality_feedback=false;")->isSuccess());
+    ASSERT_EQ(explainLogical(), planWithoutFeedback);
+    result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), count);
+    ASSERT_EQ(cardinalityFeedback->getNumEntries(), 0);
+}
+
 TEST_F(ApiTest, CreateTableAfterClosingDatabase) {
     database.reset();
     database = std::make_unique<Database>(databasePath, *systemConfig);
@@ -166,3 +218,80 @@ TEST_F(ApiTest, CreateTableAfterClosingDatabase) {
                          "MATCH (a:Test) where a.name='Alice' return a.age;");
     ASSERT_TRUE(result->isSuccess()) << result->toString();
 }
+
+#ifndef __SINGLE_THREADED__
+TEST_F(ApiTest, StreamedResultMatchesMaterializedResult) {
+    // The second query produces more chunks than the queue holds, so execution has to wait for
+    // the consumer.
+    const std::vector<std::string> queries = {
+        "MATCH (a:person)-[:knows]->(b:person) RETURN a.fName, b.fName;",
+        "UNWIND RANGE(1, 100000) AS x RETURN x, x * 2;"};
+    for (auto& query : queries) {
+        auto result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        auto expected = TestHelper::convertResultToString(*result);
+        ASSERT_TRUE(conn->query("CALL enable_result_streaming=true;")->isSuccess());
+        result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        ASSERT_THROW(result->getNumTuples(), RuntimeException);
+        ASSERT_EQ(TestHelper::convertResultToString(*result), expected);
+        ASSERT_FALSE(result->hasNext());
+        ASSERT_TRUE(conn->query("CALL enable_result_streaming=false;")->isSuccess());
+    }
+}
+
+TEST_F(ApiTest, StreamedResultDestroyedBeforeFullyRead) {
+    ASSERT_TRUE(conn->query("CALL enable_result_streaming=true;")->isSuccess());
+    auto result = conn->query("UNWIND RANGE(1, 1000000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    for (auto i = 1; i <= 10; i++) {
+        ASSERT_TRUE(result->hasNext());
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), i);
+    }
+    result.reset();
+    ApiTest::assertMatchPersonCountStar(conn.get());
+}
+
+TEST_F(ApiTest, StreamedResultFinishedByNextQuery) {
+    ASSERT_TRUE(conn->query("CALL enable_result_streaming=true;")->isSuccess());
+    auto result = conn->query("UNWIND RANGE(1, 1000000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_TRUE(result->hasNext());
+    result->getNext();
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    ASSERT_THROW(result->hasNext(), RuntimeException);
+}
+
+TEST_F(ApiTest, StreamedResultInManualTransaction) {
+    ASSERT_TRUE(conn->query("CALL enable_result_streaming=true;")->isSuccess());
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100, fName: 'Zed'});")->isSuccess());
+    auto result = conn->query("UNWIND RANGE(1, 1000000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_TRUE(result->hasNext());
+    // Stopping the stream early must not roll back the transaction.
+    result = conn->query("MATCH (a:person) RETURN COUNT(*);");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 9);
+    result.reset();
+    auto commitResult = conn->query("COMMIT;");
+    ASSERT_TRUE(commitResult->isSuccess()) << commitResult->toString();
+    result = conn->query("MATCH (a:person) WHERE a.ID = 100 RETURN a.fName;");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<std::string>(), "Zed");
+}
+
+TEST_F(ApiTest, StreamedResultExecutionError) {
+    ASSERT_TRUE(conn->query("CALL enable_result_streaming=true;")->isSuccess());
+    auto result = conn->query("UNWIND ['1', 'abc'] AS x RETURN CAST(x AS INT64);");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_THROW(
+        {
+            while (result->hasNext()) {
+                result->getNext();
+            }
+        },
+        Exception);
+    ApiTest::assertMatchPersonCountStar(conn.get());
+}
+#endif
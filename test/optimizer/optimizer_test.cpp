@@ -1,6 +1,8 @@
 #include "graph_test/graph_test.h"
+#include "optimizer/logical_operator_collector.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "test_runner/test_runner.h"
@@ -110,5 +112,44 @@ TEST_F(OptimizerTest, PkScanTest) {
     ASSERT_STREQ(ans.c_str(), "HJ(b._ID){S(b)}{E(b)IndexScan(a)}");
 }
 
+TEST_F(OptimizerTest, CountNodeTableTest) {
+    auto hasScanNodeTable = [&](const std::string& query) {
+        auto collector = optimizer::LogicalScanNodeTableCollector();
+        collector.collect(getRoot(query)->getLastOperator().get());
+        return collector.hasOperators();
+    };
+    ASSERT_FALSE(hasScanNodeTable("MATCH (a:person) RETURN COUNT(*);"));
+    ASSERT_FALSE(hasScanNodeTable("MATCH (a:person:organisation) RETURN COUNT(*);"));
+    ASSERT_TRUE(hasScanNodeTable("MATCH (a:person) WHERE a.age > 20 RETURN COUNT(*);"));
+    ASSERT_TRUE(hasScanNodeTable("MATCH (a:person) RETURN a.gender, COUNT(*);"));
+    ASSERT_TRUE(hasScanNodeTable("MATCH (a:person) RETURN COUNT(a.age);"));
+}
+
+TEST_F(OptimizerTest, EagerAggregationTest) {
+    // Returns the build side signature of each hash join whose build side is an aggregate.
+    auto getAggregatedBuildSides = [&](const std::string& query) {
+        auto plan = getRoot(query);
+        auto collector = optimizer::LogicalHashJoinCollector();
+        collector.collect(plan->getLastOperator().get());
+        std::vector<std::string> signatures;
+        for (auto& op : collector.getOperators()) {
+            if (op->getChild(1)->getOperatorType() == planner::LogicalOperatorType::AGGREGATE) {
+                auto& hashJoin = op->constCast<planner::LogicalHashJoin>();
+                signatures.push_back(hashJoin.getBuildSideSignature());
+            }
+        }
+        return signatures;
+    };
+    // Plan the extend to c on the build side so that it has duplicated join keys.
+    auto twoHop = "MATCH (a:person)-[e1:knows]->(b:person)-[e2:knows]->(c:person) "
+                  "HINT (((a JOIN e1) JOIN b) JOIN e2) JOIN c ";
+    auto signatures = getAggregatedBuildSides(std::string(twoHop) + "RETURN a.ID, COUNT(*);");
+    ASSERT_EQ(signatures.size(), 1);
+    // Feedback recorded for the aggregated build side would not match the subgraph estimate.
+    ASSERT_TRUE(signatures[0].empty());
+    ASSERT_TRUE(getAggregatedBuildSides(std::string(twoHop) + "RETURN a.ID, SUM(b.ID);").empty());
+    ASSERT_TRUE(getAggregatedBuildSides(std::string(twoHop) + "RETURN COUNT(*);").empty());
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -1,4 +1,8 @@
+#include <filesystem>
+#include <fstream>
+
 #include "common/constants.h"
+#include "common/file_system/virtual_file_system.h"
 #include "common/types/types.h"
 #include "graph_test/graph_test.h"
 #include "gtest/gtest.h"
@@ -7,6 +11,7 @@
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/enums/residency_state.h"
+#include "storage/file_handle.h"
 #include "storage/store/chunked_node_group.h"
 #include "storage/store/column_chunk.h"
 
@@ -83,5 +88,110 @@ TEST_F(EmptyBufferManagerTest, TestSpillToDiskMemoryUsage) {
     }
 }
 
+class ScanResistantEvictionTest : public EmptyDBTest {
+protected:
+    static constexpr page_idx_t NUM_FRAMES = 1024;
+    static constexpr page_idx_t NUM_HOT_PAGES = 64;
+    static constexpr page_idx_t NUM_PAGES = 4 * NUM_FRAMES;
+
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        if (inMemMode) {
+            GTEST_SKIP();
+        }
+        std::filesystem::create_directories(databasePath);
+        filePath = databasePath + "/pages";
+        // Each page is filled with its index, so that reads can be checked.
+        std::ofstream file(filePath, std::ios::binary);
+        std::vector<char> page(KUZU_PAGE_SIZE);
+        for (auto pageIdx = 0u; pageIdx < NUM_PAGES; pageIdx++) {
+            std::fill(page.begin(), page.end(), static_cast<char>(pageIdx));
+            file.write(page.data(), page.size());
+        }
+    }
+
+    std::unique_ptr<BufferManager> createBufferManager(bool scanResistantEviction) {
+        auto bm = std::make_unique<BufferManager>(databasePath, "" /* spillToDiskPath */,
+            NUM_FRAMES * KUZU_PAGE_SIZE, BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE, &vfs,
+            true /* readOnly */, scanResistantEviction);
+        fileHandle = bm->getFileHandle(filePath, FileHandle::O_PERSISTENT_FILE_READ_ONLY, &vfs,
+            nullptr /* context */);
+        return bm;
+    }
+
+    void readPage(page_idx_t pageIdx, PageAccessHint accessHint) const {
+        fileHandle->optimisticReadPage(
+            pageIdx,
+            [&](const uint8_t* frame) {
+                ASSERT_EQ(frame[0], static_cast<uint8_t>(pageIdx));
+                ASSERT_EQ(frame[KUZU_PAGE_SIZE - 1], static_cast<uint8_t>(pageIdx));
+            },
+            accessHint);
+    }
+
+    uint64_t getPageState(page_idx_t pageIdx) const {
+        return fileHandle->getPageState(pageIdx)->getState();
+    }
+
+    // Reads the hot pages by lookups, and re-reads them after every `lookupInterval` pages of a
+    // scan over the rest of the file. Returns the number of hot pages evicted by the scan.
+    page_idx_t numHotPagesEvictedByScan(bool scanResistantEviction, page_idx_t lookupInterval) {
+        auto bm = createBufferManager(scanResistantEviction);
+        for (auto pageIdx = 0u; pageIdx < NUM_HOT_PAGES; pageIdx++) {
+            readPage(pageIdx, PageAccessHint::DEFAULT);
+        }
+        page_idx_t numEvicted = 0;
+        for (auto pageIdx = NUM_HOT_PAGES; pageIdx < NUM_PAGES; pageIdx++) {
+            readPage(pageIdx, PageAccessHint::SCAN);
+            if ((pageIdx - NUM_HOT_PAGES + 1) % lookupInterval == 0) {
+                for (auto hotPageIdx = 0u; hotPageIdx < NUM_HOT_PAGES; hotPageIdx++) {
+                    numEvicted += getPageState(hotPageIdx) == PageState::EVICTED;
+                    readPage(hotPageIdx, PageAccessHint::DEFAULT);
+                }
+            }
+        }
+        return numEvicted;
+    }
+
+    VirtualFileSystem vfs;
+    std::string filePath;
+    FileHandle* fileHandle = nullptr;
+};
+
+TEST_F(ScanResistantEvictionTest, PagesLoadedByScansAreEvictedFirst) {
+    auto bm = createBufferManager(true /* scanResistantEviction */);
+    readPage(0, PageAccessHint::DEFAULT);
+    ASSERT_EQ(getPageState(0), PageState::UNLOCKED);
+    readPage(1, PageAccessHint::SCAN);
+    ASSERT_EQ(getPageState(1), PageState::MARKED);
+    // A lookup of a page loaded by a scan promotes it.
+    readPage(1, PageAccessHint::DEFAULT);
+    ASSERT_EQ(getPageState(1), PageState::UNLOCKED);
+    fileHandle->prefetchPages(2, 8);
+    for (auto pageIdx = 2u; pageIdx < 10; pageIdx++) {
+        ASSERT_EQ(getPageState(pageIdx), PageState::MARKED);
+        readPage(pageIdx, PageAccessHint::SCAN);
+        ASSERT_EQ(getPageState(pageIdx), PageState::MARKED);
+    }
+}
+
+TEST_F(ScanResistantEvictionTest, PagesLoadedByScansAreNotMarkedWhenDisabled) {
+    auto bm = createBufferManager(false /* scanResistantEviction */);
+    readPage(0, PageAccessHint::SCAN);
+    ASSERT_EQ(getPageState(0), PageState::UNLOCKED);
+    fileHandle->prefetchPages(1, 8);
+    for (auto pageIdx = 1u; pageIdx < 9; pageIdx++) {
+        ASSERT_EQ(getPageState(pageIdx), PageState::UNLOCKED);
+    }
+}
+
+TEST_F(ScanResistantEvictionTest, HotPagesSurviveScan) {
+    // The scan is four times the size of the buffer pool, and the hot pages are looked up again
+    // twice per pass of the eviction cursor over the pool.
+    constexpr page_idx_t lookupInterval = NUM_FRAMES / 2;
+    ASSERT_EQ(numHotPagesEvictedByScan(true /* scanResistantEviction */, lookupInterval), 0);
+    ASSERT_GT(numHotPagesEvictedByScan(false /* scanResistantEviction */, lookupInterval), 0);
+}
+
 } // namespace testing
 } // namespace kuzu
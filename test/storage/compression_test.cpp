@@ -11,6 +11,7 @@
 #include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
 #include "storage/compression/compression.h"
+#include "storage/compression/fsst_compression.h"
 #include "storage/storage_utils.h"
 
 using namespace kuzu::common;
@@ -612,3 +613,53 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+/*
+ * FSST Tests
+ */
+
+TEST(CompressionTests, FSSTRoundTrip) {
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; i++) {
+        strings.push_back("https://www.example.com/items/" + std::to_string(i * 7919) + "?lang=en");
+    }
+    strings.push_back("");
+    strings.push_back(std::string("\0\xff\x01unseen bytes", 15));
+    std::vector<std::string_view> sample(strings.begin(), strings.end());
+    const auto metadata = FSSTCompression::buildSymbolTable(sample);
+    EXPECT_GT(metadata.numSymbols, 0);
+    const FSSTEncoder encoder{metadata};
+    uint64_t totalSize = 0, totalCompressedSize = 0;
+    for (const auto& str : strings) {
+        std::vector<uint8_t> compressed;
+        encoder.compress(str, compressed);
+        EXPECT_EQ(compressed.size(), encoder.getCompressedSize(str));
+        EXPECT_LE(compressed.size(), FSSTCompression::getMaxCompressedSize(str.size()));
+        std::string decompressed;
+        FSSTCompression::decompress(metadata, compressed.data(), compressed.size(), decompressed);
+        EXPECT_EQ(decompressed, str);
+        totalSize += str.size();
+        totalCompressedSize += compressed.size();
+    }
+    EXPECT_LT(totalCompressedSize, totalSize / 2);
+}
+
+TEST(CompressionTests, FSSTMetadataSerialization) {
+    std::vector<std::string_view> sample{"abcabcabc", "abcdefgh", "xyzxyzxyz"};
+    CompressionMetadata metadata(StorageValue(0), StorageValue(255), CompressionType::FSST);
+    metadata.extraMetadata =
+        std::make_unique<FSSTMetadata>(FSSTCompression::buildSymbolTable(sample));
+    const auto writer = std::make_shared<BufferedSerializer>();
+    Serializer ser{writer};
+    metadata.serialize(ser);
+    Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = CompressionMetadata::deserialize(deser);
+    ASSERT_EQ(deserialized.compression, CompressionType::FSST);
+    const auto& original = *metadata.fsstMetadata();
+    const auto& result = *deserialized.fsstMetadata();
+    ASSERT_EQ(result.numSymbols, original.numSymbols);
+    for (auto i = 0u; i < original.numSymbols; i++) {
+        EXPECT_EQ(result.symbols[i], original.symbols[i]);
+        EXPECT_EQ(result.symbolLengths[i], original.symbolLengths[i]);
+    }
+}
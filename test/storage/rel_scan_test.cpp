@@ -131,5 +131,46 @@ TEST_F(RelScanTest, ScanFwd) {
     compare(2, {0, 1, 3}, {6, 7, 8}, {1, 4, 11});
 }
 
+// Duplicated strings scanned from the same dictionary entry should share the scanned string's
+// overflow buffer instead of each getting a copy.
+TEST_F(RelScanTest, ScanDuplicatedStringsShareOverflow) {
+    conn->query("COMMIT");
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE Tagged(FROM Item TO Item, tag STRING)")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 9) AS i CREATE (:Item {id: i})")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:Item), (b:Item) WHERE a.id = 0 AND b.id > 0 "
+                            "CREATE (a)-[:Tagged {tag: concat('a-long-tag-name-', "
+                            "string(b.id % 2))}]->(b)")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    conn->query("BEGIN TRANSACTION");
+    auto transaction = context->getTx();
+    auto itemTableID = catalog->getTableID(transaction, "Item");
+    auto taggedTableID = catalog->getTableID(transaction, "Tagged");
+    auto taggedEntry = kuzu::graph::GraphEntry(
+        catalog->getTableEntries(transaction, common::table_id_vector_t{itemTableID}),
+        catalog->getTableEntries(transaction, common::table_id_vector_t{taggedTableID}));
+    auto taggedGraph = kuzu::graph::OnDiskGraph(context, taggedEntry);
+    auto tagPropertyIndex =
+        catalog->getTableCatalogEntry(transaction, taggedTableID)->getPropertyIdx("tag");
+    auto scanState = taggedGraph.prepareScan(taggedTableID, tagPropertyIndex);
+
+    std::unordered_map<std::string, uint64_t> overflowPtrs;
+    uint64_t numScanned = 0;
+    for (const auto chunk : taggedGraph.scanFwd(nodeID_t{0, itemTableID}, *scanState)) {
+        chunk.forEach<common::ku_string_t>([&](auto nbr, auto, auto tag) {
+            EXPECT_EQ(tag.getAsString(), "a-long-tag-name-" + std::to_string(nbr.offset % 2));
+            EXPECT_FALSE(common::ku_string_t::isShortString(tag.len));
+            auto [it, inserted] = overflowPtrs.emplace(tag.getAsString(), tag.overflowPtr);
+            if (!inserted) {
+                EXPECT_EQ(it->second, tag.overflowPtr);
+            }
+            numScanned++;
+        });
+    }
+    EXPECT_EQ(numScanned, 9);
+    EXPECT_EQ(overflowPtrs.size(), 2);
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -0,0 +1,74 @@
+#include <fstream>
+
+#include "common/constants.h"
+#include "graph_test/graph_test.h"
+#include "storage/storage_version_info.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace testing {
+
+class WALTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    std::string getWALFilePath() const {
+        return databasePath + "/" + StorageConstants::WAL_FILE_SUFFIX;
+    }
+
+    // Leaves a committed transaction in the WAL when the database is closed.
+    void writeUncheckpointedWAL() {
+        ASSERT_TRUE(conn->query("CALL auto_checkpoint=false")->isSuccess());
+        ASSERT_TRUE(conn->query("CALL force_checkpoint_on_close=false")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("CREATE NODE TABLE Person(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE (:Person {id: 1})")->isSuccess());
+        conn.reset();
+        database.reset();
+    }
+};
+
+TEST_F(WALTest, ReplayWALWithSameVersion) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    writeUncheckpointedWAL();
+    createDBAndConn();
+    auto result = conn->query("MATCH (p:Person) RETURN p.id");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+}
+
+TEST_F(WALTest, RejectWALWithDifferentVersion) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    writeUncheckpointedWAL();
+    // The header is the magic bytes followed by the storage version.
+    std::fstream walFile(getWALFilePath(), std::ios::in | std::ios::out | std::ios::binary);
+    ASSERT_TRUE(walFile.is_open());
+    char magicBytes[4];
+    walFile.read(magicBytes, sizeof(magicBytes));
+    ASSERT_EQ(std::string(magicBytes, sizeof(magicBytes)), StorageVersionInfo::MAGIC_BYTES);
+    const storage_version_t otherVersion = StorageVersionInfo::getStorageVersion() - 1;
+    walFile.write(reinterpret_cast<const char*>(&otherVersion), sizeof(otherVersion));
+    walFile.close();
+    try {
+        createDBAndConn();
+        FAIL() << "Expected replaying the WAL file to fail.";
+    } catch (const Exception& e) {
+        ASSERT_NE(std::string(e.what()).find("Trying to replay a WAL file with a different "
+                                             "version"),
+            std::string::npos)
+            << e.what();
+    }
+}
+
+} // namespace testing
+} // namespace kuzu